@@ -0,0 +1,156 @@
+// ADPCM Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Hardware configuration: -
+
+
+#include <stdint.h>
+#include "inc/adpcm.h"
+#include "inc/dsp.h"
+#include "inc/ramexec.h"
+
+#define ADPCM_SCALE 4                   // samples are << 4 inside the codec
+
+static const int16_t stepTable[89] RAMCONST =
+{
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767
+};
+
+static const int8_t indexTable[16] RAMCONST =
+{
+    -1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+typedef struct _ADPCM_STATE
+{
+    int32_t predictor;
+    int8_t index;
+} ADPCM_STATE;
+
+// Reconstruct one sample from a code and advance the state
+RAMFUNC static int32_t decodeNibble(ADPCM_STATE* s, uint8_t code)
+{
+    int32_t step = stepTable[s->index];
+    int32_t diff = step >> 3;
+    if (code & 4) diff += step;
+    if (code & 2) diff += step >> 1;
+    if (code & 1) diff += step >> 2;
+    s->predictor += (code & 8) ? -diff : diff;
+    if (s->predictor > 32767)
+        s->predictor = 32767;
+    if (s->predictor < -32768)
+        s->predictor = -32768;
+    s->index += indexTable[code];
+    if (s->index < 0)
+        s->index = 0;
+    if (s->index > 88)
+        s->index = 88;
+    return s->predictor;
+}
+
+// Pick the code closest to x, decoding it keeps encoder and decoder in step
+static uint8_t encodeNibble(ADPCM_STATE* s, int32_t x)
+{
+    int32_t step = stepTable[s->index];
+    int32_t diff = x - s->predictor;
+    uint8_t code = 0;
+    if (diff < 0)
+    {
+        code = 8;
+        diff = -diff;
+    }
+    if (diff >= step) { code |= 4; diff -= step; }
+    step >>= 1;
+    if (diff >= step) { code |= 2; diff -= step; }
+    step >>= 1;
+    if (diff >= step) { code |= 1; }
+    decodeNibble(s, code);
+    return code;
+}
+
+static void writeHeader(uint8_t* out, const ADPCM_STATE* s)
+{
+    out[0] = s->predictor & 0xFF;
+    out[1] = (s->predictor >> 8) & 0xFF;
+    out[2] = s->index;
+}
+
+static void readHeader(ADPCM_STATE* s, const uint8_t* in)
+{
+    s->predictor = (int16_t) (in[0] | (in[1] << 8));
+    s->index = in[2];
+}
+
+// Encode one channel into the low (shift 0) or high (shift 4) nibbles,
+// returns the squared reconstruction error
+static uint64_t encodeChannel(uint8_t* codes, const int16_t* x, uint16_t n, ADPCM_STATE s, uint8_t shift)
+{
+    uint64_t err = 0;
+    int32_t e;
+    uint16_t i;
+    for (i = 0; i < n; i++)
+    {
+        codes[i] = (codes[i] & ~(0xF << shift)) | (encodeNibble(&s, x[i] * (1 << ADPCM_SCALE)) << shift);
+        e = s.predictor - x[i] * (1 << ADPCM_SCALE);
+        err += (int64_t) e * e;
+    }
+    return err;
+}
+
+// Start on the first sample with the step index that fits the block best
+static ADPCM_STATE bestStart(uint8_t* codes, const int16_t* x, uint16_t n, uint8_t shift)
+{
+    ADPCM_STATE s, best;
+    uint64_t err, bestErr = UINT64_MAX;
+    s.predictor = x[0] * (1 << ADPCM_SCALE);
+    best = s;
+    for (s.index = 0; s.index <= 88; s.index++)
+    {
+        err = encodeChannel(codes, x, n, s, shift);
+        if (err < bestErr)
+        {
+            bestErr = err;
+            best = s;
+        }
+    }
+    encodeChannel(codes, x, n, best, shift);
+    return best;
+}
+
+// Encode n <= ADPCM_BLOCK pairs (host side, searches the start step per
+// channel), returns the block size in bytes
+uint16_t encodeAdpcmBlock(uint8_t* out, const int16_t* sI, const int16_t* sQ, uint16_t n)
+{
+    ADPCM_STATE stateI, stateQ;
+    stateI = bestStart(&out[ADPCM_HEADER], sI, n, 0);
+    stateQ = bestStart(&out[ADPCM_HEADER], sQ, n, 4);
+    writeHeader(&out[0], &stateI);
+    writeHeader(&out[3], &stateQ);
+    return ADPCM_BLOCK_BYTES(n);
+}
+
+// Decode n pairs into packed I/Q words
+RAMFUNC void decodeAdpcmBlock(uint32_t* out, const uint8_t* in, uint16_t n)
+{
+    ADPCM_STATE stateI, stateQ;
+    uint16_t i;
+    uint8_t code;
+    readHeader(&stateI, &in[0]);
+    readHeader(&stateQ, &in[3]);
+    in += ADPCM_HEADER;
+    for (i = 0; i < n; i++)
+    {
+        code = in[i];
+        out[i] = PACK16(decodeNibble(&stateI, code & 0xF) >> ADPCM_SCALE,
+                        decodeNibble(&stateQ, code >> 4) >> ADPCM_SCALE);
+    }
+}
@@ -0,0 +1,112 @@
+// AWG Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Hardware configuration: -
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/awg.h"
+#include "inc/dsp.h"
+#include "inc/ramexec.h"
+
+#define AWG_SPAN 4095                   // LSb around the DAC zero
+
+// One extra entry repeats sample 0 so interpolation wraps without a branch
+static uint32_t wave[AWG_MAX + 1];
+static uint16_t waveLength = 0;
+static uint32_t address = 0;            // Q16.16 sample index
+static uint32_t step = 1 << 16;
+static uint32_t end = 0;                // waveLength in Q16.16
+static bool interpolation = false;
+
+bool setAwgLength(uint16_t length)
+{
+    if (length == 0 || length > AWG_MAX)
+        return false;
+    waveLength = length;
+    end = (uint32_t) length << 16;
+    if (step >= end)
+        step = end - 1;
+    resetAwg();
+    return true;
+}
+
+// Forget the waveform after a failed upload, play needs a new load
+void clearAwg(void)
+{
+    waveLength = 0;
+    end = 0;
+    resetAwg();
+}
+
+uint16_t getAwgLength(void)
+{
+    return waveLength;
+}
+
+// Samples are limited to the DAC span so interpolation cannot overflow
+static int16_t clampSample(int16_t x)
+{
+    if (x > AWG_SPAN)
+        return AWG_SPAN;
+    if (x < -AWG_SPAN)
+        return -AWG_SPAN;
+    return x;
+}
+
+void writeAwgSample(uint16_t index, int16_t sI, int16_t sQ)
+{
+    if (index >= waveLength)
+        return;
+    sI = clampSample(sI);
+    sQ = clampSample(sQ);
+    wave[index] = PACK16(sI, sQ);
+    if (index == 0)
+        wave[waveLength] = wave[0];
+}
+
+// step = waveform samples advanced per output sample, (0, length), held
+// to that range before the Q16.16 conversion
+void setAwgRate(float rate, bool interpolate)
+{
+    uint32_t s;
+    if (!(rate * 65536 >= 1))
+        s = 1;
+    else if (rate * 65536 >= end)
+        s = end - 1;
+    else
+        s = rate * 65536;
+    step = s;
+    interpolation = interpolate;
+}
+
+void resetAwg(void)
+{
+    address = 0;
+}
+
+// Next sample of the waveform, constant time for any rate
+RAMFUNC void awgSample(int32_t* sI, int32_t* sQ)
+{
+    uint32_t index = address >> 16;
+    uint32_t a = wave[index];
+    int32_t aI = (int16_t) a, aQ = (int16_t) (a >> 16);
+
+    if (interpolation)
+    {
+        uint32_t b = wave[index + 1];
+        int32_t frac = address & 0xFFFF;
+        aI += (((int16_t) b - aI) * frac) >> 16;
+        aQ += (((int16_t) (b >> 16) - aQ) * frac) >> 16;
+    }
+    *sI = aI;
+    *sQ = aQ;
+
+    address += step;
+    if (address >= end)
+        address -= end;
+}
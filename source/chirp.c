@@ -0,0 +1,144 @@
+// Chirp Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Hardware configuration: -
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include "inc/chirp.h"
+#include "inc/nco.h"
+#include "inc/ramexec.h"
+
+#define FRAC        24                  // fractional bits below the phase increment
+#define RATIO_BITS  28                  // log: segment ratio in Q4.28
+#define RATIO_MAX   16.0
+
+// Sweep description, frequencies as phase increments with FRAC fraction bits
+static CHIRP_LAW sweepLaw = LINEAR;
+static CHIRP_REPEAT sweepRepeat = ONCE;
+static int64_t startFreq = 0, stopFreq = 0;
+static int64_t linearRate = 0;
+static uint32_t ratioUp = 1u << RATIO_BITS;     // log: frequency ratio per segment
+static uint32_t ratioDown = 1u << RATIO_BITS;
+static uint32_t legLength = 0;          // samples per sweep leg
+static int32_t chirpGainI = 0, chirpGainQ = 0;
+
+// Running state
+static uint32_t phase = 0;
+static int64_t freq = 0;
+static int64_t rate = 0;
+static uint64_t segmentFreq = 0;        // log: end of the current segment
+static uint32_t ratio = 1u << RATIO_BITS;
+static uint32_t left = 0;
+static uint8_t segmentLeft = 0;
+static bool down = false;
+static bool running = false;
+
+// x * r >> RATIO_BITS for x < 2^56 in two 32x32 products, no float in the ISR
+static uint64_t scaleFreq(uint64_t x, uint32_t r)
+{
+    return (((x >> 32) * r) << (32 - RATIO_BITS)) + (((x & 0xFFFFFFFFu) * r) >> RATIO_BITS);
+}
+
+// Log law: aim rate at the end frequency of the next segment
+static void nextSegment(void)
+{
+    segmentFreq = scaleFreq(segmentFreq, ratio);
+    rate = ((int64_t) segmentFreq - freq) >> CHIRP_SEGMENT_BITS;
+    segmentLeft = CHIRP_SEGMENT;
+}
+
+// Start a leg from its exact end point; phase carries on
+static void startLeg(bool reverse)
+{
+    down = reverse;
+    freq = down ? stopFreq : startFreq;
+    left = legLength;
+    if (sweepLaw == LINEAR)
+        rate = down ? -linearRate : linearRate;
+    else
+    {
+        segmentFreq = freq;
+        ratio = down ? ratioDown : ratioUp;
+        nextSegment();
+    }
+}
+
+// Sweep f0 -> f1 Hz in seconds at sample rate fs, at least one segment and
+// fewer than 2^31 samples. Linear sweeps may cross DC (|f| < fs/2), log
+// sweeps need 0 < f0, f1 < fs/2 and less than a factor RATIO_MAX per
+// segment.
+bool setChirp(float f0, float f1, float seconds, float fs, CHIRP_LAW law, CHIRP_REPEAT repeat,
+              int32_t gainI, int32_t gainQ)
+{
+    float segments = seconds * fs / CHIRP_SEGMENT;
+    uint32_t n;
+    double segmentRatio = 1;            // unused by linear sweeps
+    if (!(segments >= 0.5f && segments < 2147483648.0f / CHIRP_SEGMENT)
+        || fabsf(f0) >= fs / 2 || fabsf(f1) >= fs / 2)
+        return false;
+    n = lroundf(segments) * CHIRP_SEGMENT;
+    if (law == LOGARITHMIC)
+    {
+        if (f0 <= 0 || f1 <= 0)
+            return false;
+        segmentRatio = pow((double) f1 / f0, (double) CHIRP_SEGMENT / n);
+        if (segmentRatio >= RATIO_MAX || segmentRatio <= 1 / RATIO_MAX)
+            return false;
+    }
+    sweepLaw = law;
+    sweepRepeat = repeat;
+    legLength = n;
+    startFreq = (int64_t) (int32_t) ncoFrequencyWord(f0, fs) * (1 << FRAC);
+    stopFreq = (int64_t) (int32_t) ncoFrequencyWord(f1, fs) * (1 << FRAC);
+    linearRate = llroundf((float) (stopFreq - startFreq) / n);
+    ratioUp = llround(segmentRatio * (1u << RATIO_BITS));
+    ratioDown = llround((1u << RATIO_BITS) / segmentRatio);
+    chirpGainI = gainI;
+    chirpGainQ = gainQ;
+    resetChirp();
+    return true;
+}
+
+// Restart the sweep from f0, call with the mode stopped
+void resetChirp(void)
+{
+    phase = 0;
+    running = legLength != 0;
+    if (running)
+        startLeg(false);
+}
+
+// Next sample, returns the trigger marker (high for the first
+// CHIRP_MARKER samples of every leg)
+RAMFUNC bool chirpSample(int32_t* sI, int32_t* sQ)
+{
+    bool marker;
+    if (!running)
+    {
+        *sI = 0;
+        *sQ = 0;
+        return false;
+    }
+    marker = (legLength - left) < CHIRP_MARKER;
+    *sI = (ncoSin(phase) * chirpGainI) >> 15;
+    *sQ = (ncoCos(phase) * chirpGainQ) >> 15;
+    phase += (uint32_t) (freq >> FRAC);
+    freq += rate;
+
+    if (sweepLaw == LOGARITHMIC && --segmentLeft == 0)
+        nextSegment();
+    if (--left == 0)
+    {
+        if (sweepRepeat == ONCE)
+            running = false;
+        else
+            startLeg(sweepRepeat == UPDOWN && !down);
+    }
+    return marker;
+}
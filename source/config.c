@@ -0,0 +1,166 @@
+// Configuration Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Hardware configuration: -
+
+// Record layout (words):
+//   [0] magic  [1] version  [2] payload length N  [3..3+N) payload  [3+N] crc32
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "inc/config.h"
+#include "inc/eeprom.h"
+
+#define HEADER_WORDS  3
+#define PAYLOAD_WORDS (17 + PAYLOAD_MAX / 4)
+
+static uint32_t crc32(const uint32_t* words, uint16_t count)
+{
+    uint32_t crc = 0xFFFFFFFF;
+    uint16_t i;
+    uint8_t b;
+    for (i = 0; i < count; i++)
+    {
+        crc ^= words[i];
+        for (b = 0; b < 32; b++)
+            crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+    return ~crc;
+}
+
+static uint32_t floatBits(float f)
+{
+    uint32_t w;
+    memcpy(&w, &f, sizeof(w));
+    return w;
+}
+
+static float bitsFloat(uint32_t w)
+{
+    float f;
+    memcpy(&f, &w, sizeof(f));
+    return f;
+}
+
+// Serialize into words (payload only), returns the word count
+uint16_t packConfig(const CONFIG* cfg, uint32_t* words)
+{
+    uint16_t n = 0;
+    uint8_t i;
+    words[n++] = cfg->mode | (cfg->filter << 8) | (cfg->tone << 9) | (cfg->differential << 10)
+               | ((uint32_t) cfg->scheme << 16) | ((uint32_t) cfg->sps << 24);
+    words[n++] = floatBits(cfg->sampleRate);
+    words[n++] = cfg->freqI;
+    words[n++] = cfg->freqQ;
+    words[n++] = cfg->rawI | ((uint32_t) cfg->rawQ << 16);
+    for (i = 0; i < 2; i++)
+    {
+        words[n++] = cfg->ch[i].gain;
+        words[n++] = cfg->ch[i].phase;
+        words[n++] = cfg->ch[i].offset;
+    }
+    words[n++] = cfg->payloadLength;
+    for (i = 0; i < PAYLOAD_MAX; i += 4)
+        words[n++] = (uint8_t) cfg->payload[i] | ((uint32_t) (uint8_t) cfg->payload[i + 1] << 8)
+                   | ((uint32_t) (uint8_t) cfg->payload[i + 2] << 16) | ((uint32_t) (uint8_t) cfg->payload[i + 3] << 24);
+    words[n++] = cfg->fskType;
+    words[n++] = floatBits(cfg->fskParam);
+    words[n++] = cfg->prbsSource | (cfg->prbsOrder << 8) | ((uint32_t) cfg->fecRate << 16)
+               | ((uint32_t) cfg->scrambler << 24);
+    words[n++] = cfg->prbsSeed;
+    words[n++] = cfg->prbsErrors;
+    return n;
+}
+
+// Deserialize payload words, false if the count does not match this version
+bool unpackConfig(CONFIG* cfg, const uint32_t* words, uint16_t count)
+{
+    uint16_t n = 0;
+    uint8_t i;
+    if (count != PAYLOAD_WORDS)
+        return false;
+    cfg->mode = words[n] & 0xFF;
+    cfg->filter = (words[n] >> 8) & 1;
+    cfg->tone = (words[n] >> 9) & 1;
+    cfg->differential = (words[n] >> 10) & 1;
+    cfg->scheme = (words[n] >> 16) & 0xFF;
+    cfg->sps = words[n++] >> 24;
+    cfg->sampleRate = bitsFloat(words[n++]);
+    cfg->freqI = words[n++];
+    cfg->freqQ = words[n++];
+    cfg->rawI = words[n] & 0xFFFF;
+    cfg->rawQ = words[n++] >> 16;
+    for (i = 0; i < 2; i++)
+    {
+        cfg->ch[i].gain = words[n++];
+        cfg->ch[i].phase = words[n++];
+        cfg->ch[i].offset = words[n++];
+    }
+    cfg->payloadLength = words[n++];
+    if (cfg->payloadLength > PAYLOAD_MAX)
+        return false;
+    for (i = 0; i < PAYLOAD_MAX; i += 4, n++)
+    {
+        cfg->payload[i] = words[n];
+        cfg->payload[i + 1] = words[n] >> 8;
+        cfg->payload[i + 2] = words[n] >> 16;
+        cfg->payload[i + 3] = words[n] >> 24;
+    }
+    cfg->fskType = words[n++];
+    cfg->fskParam = bitsFloat(words[n++]);
+    cfg->prbsSource = words[n] & 1;
+    cfg->prbsOrder = (words[n] >> 8) & 0xFF;
+    cfg->fecRate = (words[n] >> 16) & 0xFF;
+    cfg->scrambler = words[n++] >> 24;
+    cfg->prbsSeed = words[n++];
+    cfg->prbsErrors = words[n++];
+    return true;
+}
+
+void saveConfig(const CONFIG* cfg)
+{
+    uint32_t words[CONFIG_MAX_WORDS];
+    uint16_t n, i;
+    words[0] = CONFIG_MAGIC;
+    words[1] = CONFIG_VERSION;
+    n = packConfig(cfg, &words[HEADER_WORDS]);
+    words[2] = n;
+    n += HEADER_WORDS;
+    words[n] = crc32(words, n);
+    for (i = 0; i <= n; i++)
+        writeEeprom(CONFIG_EEPROM_ADD + i, words[i]);
+}
+
+// Read back and validate a saved record, false leaves cfg untouched
+bool loadConfig(CONFIG* cfg)
+{
+    uint32_t words[CONFIG_MAX_WORDS];
+    CONFIG loaded;
+    uint16_t n, i;
+    for (i = 0; i < HEADER_WORDS; i++)
+        words[i] = readEeprom(CONFIG_EEPROM_ADD + i);
+    if (words[0] != CONFIG_MAGIC || words[1] != CONFIG_VERSION)
+        return false;
+    n = words[2] + HEADER_WORDS;
+    if (n >= CONFIG_MAX_WORDS)
+        return false;
+    for (; i <= n; i++)
+        words[i] = readEeprom(CONFIG_EEPROM_ADD + i);
+    if (words[n] != crc32(words, n))
+        return false;
+    if (!unpackConfig(&loaded, &words[HEADER_WORDS], words[2]))
+        return false;
+    *cfg = loaded;
+    return true;
+}
+
+// Invalidate the record so the next boot comes up idle
+void clearConfig(void)
+{
+    writeEeprom(CONFIG_EEPROM_ADD, 0xFFFFFFFF);
+}
@@ -0,0 +1,198 @@
+// Constellation Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Hardware configuration: -
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include "inc/constellation.h"
+#include "inc/dsp.h"
+
+const char* schemeNames[SCHEME_COUNT] =
+{
+    "ook", "bpsk", "qpsk", "8psk", "16qam", "64qam", "256qam", "16apsk", "32apsk",
+    "oqpsk", "pi4dqpsk"
+};
+
+// Scratch points before scaling to DAC LSb
+static float pointI[CONSTELLATION_MAX];
+static float pointQ[CONSTELLATION_MAX];
+
+// Unit component to Q15, +1 saturates to 32767
+static int32_t unitQ15(float x)
+{
+    int32_t q = lroundf(x * 32768);
+    return (q > 32767) ? 32767 : q;
+}
+
+static uint8_t gray(uint8_t k)
+{
+    return k ^ (k >> 1);
+}
+
+static uint8_t grayInverse(uint8_t g)
+{
+    g ^= g >> 1;
+    g ^= g >> 2;
+    g ^= g >> 4;
+    return g;
+}
+
+// M points on the unit circle, Gray labelled around the circle
+static void buildPsk(CONSTELLATION* c, uint16_t m, float offset)
+{
+    uint16_t k;
+    for (k = 0; k < m; k++)
+    {
+        pointI[k] = cosf(2 * (float) M_PI * k / m + offset);
+        pointQ[k] = sinf(2 * (float) M_PI * k / m + offset);
+        c->map[gray(k)] = k;
+    }
+}
+
+// Square QAM, low half of the symbol selects the I level and the high half
+// the Q level, each Gray coded along its axis
+static void buildQam(CONSTELLATION* c)
+{
+    uint8_t n = c->bits / 2;
+    uint16_t levels = 1 << n;
+    uint16_t sym, li, lq;
+    for (sym = 0; sym <= c->mask; sym++)
+    {
+        li = grayInverse(sym & (levels - 1));
+        lq = grayInverse(sym >> n);
+        c->map[sym] = li + (lq << n);
+        pointI[li + (lq << n)] = -1 + 2.0f * li / (levels - 1);
+        pointQ[li + (lq << n)] = -1 + 2.0f * lq / (levels - 1);
+    }
+}
+
+// Concentric rings listed inner to outer, each ring takes a contiguous
+// power-of-two label range and is Gray labelled around its circumference.
+// Inner rings are rotated half a step to keep their points apart.
+static void buildApsk(CONSTELLATION* c, const uint8_t* size, const float* radius, uint8_t rings)
+{
+    uint16_t start = 0, k;
+    uint8_t r;
+    float offset;
+    for (r = 0; r < rings; r++)
+    {
+        offset = (r < rings - 1) ? (float) M_PI / size[r] : 0;
+        for (k = 0; k < size[r]; k++)
+        {
+            pointI[start + k] = radius[r] * cosf(2 * (float) M_PI * k / size[r] + offset);
+            pointQ[start + k] = radius[r] * sinf(2 * (float) M_PI * k / size[r] + offset);
+            c->map[start + gray(k)] = start + k;
+        }
+        start += size[r];
+    }
+}
+
+int8_t findScheme(const char* name)
+{
+    int8_t i;
+    for (i = 0; i < SCHEME_COUNT; i++)
+        if (strcmp(name, schemeNames[i]) == 0)
+            return i;
+    return -1;
+}
+
+// Plain PSK: the point index is the phase index, so differential encoding
+// applies (see makeDifferential)
+bool pskScheme(SCHEME scheme)
+{
+    return scheme == BPSK || scheme == QPSK || scheme == PSK8;
+}
+
+// Build the points of a scheme scaled so the largest component reaches the
+// channel full scale (gainI/gainQ LSb). Points are rounded to Q15 first and
+// scaled in integer arithmetic, so every build gives the same codes.
+void buildConstellation(CONSTELLATION* c, SCHEME scheme, int32_t gainI, int32_t gainQ)
+{
+    static const uint8_t apsk16Size[2] = {8, 8};
+    static const float apsk16Radius[2] = {0.5f, 1.0f};
+    static const uint8_t apsk32Size[3] = {8, 8, 16};
+    static const float apsk32Radius[3] = {0.35f, 0.65f, 1.0f};
+    static const uint8_t bits[SCHEME_COUNT] = {1, 1, 2, 3, 4, 6, 8, 4, 5, 2, 2};
+    // pi/4-DQPSK phase steps in units of pi/4 for dibits 00, 01, 10, 11
+    static const uint8_t pi4Steps[4] = {1, 3, 7, 5};
+    uint16_t k, m;
+    float peak = 0;
+
+    c->bits = bits[scheme];
+    c->mask = (1 << c->bits) - 1;
+    c->diffMask = 0;
+    c->offset = false;
+    c->psk = pskScheme(scheme);
+    m = c->mask + 1;
+
+    switch (scheme)
+    {
+    case OOK:
+        pointI[0] = 0; pointQ[0] = 0;
+        pointI[1] = 1; pointQ[1] = 0;
+        c->map[0] = 0;
+        c->map[1] = 1;
+        break;
+    case BPSK:
+    case PSK8:
+        buildPsk(c, m, 0);
+        break;
+    case QPSK:
+        buildPsk(c, m, (float) M_PI / 4);
+        break;
+    case OQPSK:
+        buildPsk(c, m, (float) M_PI / 4);
+        c->offset = true;
+        break;
+    case PI4DQPSK:
+        // Dibits select a step around 8PSK, alternating between two QPSK sets
+        m = 8;
+        buildPsk(c, m, 0);
+        for (k = 0; k < 4; k++)
+            c->map[k] = pi4Steps[k];
+        c->diffMask = 7;
+        break;
+    case QAM16:
+    case QAM64:
+    case QAM256:
+        buildQam(c);
+        break;
+    case APSK16:
+        buildApsk(c, apsk16Size, apsk16Radius, 2);
+        break;
+    case APSK32:
+        buildApsk(c, apsk32Size, apsk32Radius, 3);
+        break;
+    default:
+        break;
+    }
+
+    c->pointMask = m - 1;
+    for (k = 0; k < m; k++)
+    {
+        if (fabsf(pointI[k]) > peak)
+            peak = fabsf(pointI[k]);
+        if (fabsf(pointQ[k]) > peak)
+            peak = fabsf(pointQ[k]);
+    }
+    for (k = 0; k < m; k++)
+        c->point[k] = PACK16((unitQ15(pointI[k] / peak) * gainI + Q15_ROUND) >> 15,
+                             (unitQ15(pointQ[k] / peak) * gainQ + Q15_ROUND) >> 15);
+}
+
+// DBPSK/DQPSK/D8PSK: the Gray mapped value becomes a phase step, so the
+// mapper adds it to the previous point index modulo M (one add and mask)
+bool makeDifferential(CONSTELLATION* c, bool on)
+{
+    if (!c->psk)
+        return !on;
+    c->diffMask = on ? c->pointMask : 0;
+    return true;
+}
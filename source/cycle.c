@@ -0,0 +1,20 @@
+// Cycle Counter Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Hardware configuration: -
+
+
+#include <stdint.h>
+#include <tm4c123gh6pm.h>
+#include "inc/cycle.h"
+
+// Enable trace and start the free running DWT cycle counter
+void initCycleCounter(void)
+{
+    NVIC_DBG_INT_R |= DEMCR_TRCENA;
+    DWT_CYCCNT_R = 0;
+    DWT_CTRL_R |= DWT_CTRL_CYCCNTENA;
+}
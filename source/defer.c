@@ -0,0 +1,58 @@
+// Deferred Work Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Hardware configuration: -
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/defer.h"
+#include "inc/nvic.h"
+#include "inc/load.h"
+#include "inc/ramexec.h"
+
+static DEFERRED_WORK works[DEFER_MAX];
+static volatile bool pending[DEFER_MAX];
+static uint8_t workCount = 0;
+
+// PendSV at the given (normally lowest) priority
+void initDeferredWork(uint8_t priority)
+{
+    setNvicPendSvPriority(priority);
+}
+
+// Register a work item, returns its id or -1 when the table is full
+int8_t addDeferredWork(DEFERRED_WORK work)
+{
+    if (workCount == DEFER_MAX)
+        return -1;
+    works[workCount] = work;
+    pending[workCount] = false;
+    return workCount++;
+}
+
+// Any context: run work id from PendSV
+RAMFUNC void deferWork(uint8_t id)
+{
+    pending[id] = true;
+    pendNvicPendSv();
+}
+
+// Runs every pending item, the flag is cleared first so a deferral
+// during the work is not lost
+RAMFUNC void pendSvIsr(void)
+{
+    LOAD_MARK mark;
+    uint8_t i;
+    beginLoad(&mark);
+    for (i = 0; i < workCount; i++)
+        if (pending[i])
+        {
+            pending[i] = false;
+            works[i]();
+        }
+    endLoad(&mark, LOAD_DEFER);
+}
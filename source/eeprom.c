@@ -0,0 +1,56 @@
+// EEPROM Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Hardware configuration:
+// 2 KB on-chip EEPROM, 32 blocks of 16 words, addressed here by word
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <tm4c123gh6pm.h>
+#include "inc/eeprom.h"
+
+// Power or reset recovery failed if a write/erase must be retried
+static bool eepromRetry(void)
+{
+    return (EEPROM_EESUPP_R & (EEPROM_EESUPP_PRETRY | EEPROM_EESUPP_ERETRY)) != 0;
+}
+
+// Enable the EEPROM (datasheet init sequence: clock, wait for the module to
+// settle, check, software reset, wait again, check), returns false if a
+// previous write/erase must be retried
+bool initEeprom(void)
+{
+    SYSCTL_RCGCEEPROM_R |= SYSCTL_RCGCEEPROM_R0;
+    _delay_cycles(6);
+    while (!(SYSCTL_PREEPROM_R & SYSCTL_PREEPROM_R0));
+    while (EEPROM_EEDONE_R & EEPROM_EEDONE_WORKING);
+    if (eepromRetry())
+        return false;
+
+    SYSCTL_SREEPROM_R |= SYSCTL_SREEPROM_R0;
+    SYSCTL_SREEPROM_R &= ~SYSCTL_SREEPROM_R0;
+    _delay_cycles(6);
+    while (!(SYSCTL_PREEPROM_R & SYSCTL_PREEPROM_R0));
+    while (EEPROM_EEDONE_R & EEPROM_EEDONE_WORKING);
+    return !eepromRetry();
+}
+
+uint32_t readEeprom(uint16_t add)
+{
+    EEPROM_EEBLOCK_R = add >> 4;
+    EEPROM_EEOFFSET_R = add & 0xF;
+    return EEPROM_EERDWR_R;
+}
+
+// Blocking write of one word
+void writeEeprom(uint16_t add, uint32_t data)
+{
+    EEPROM_EEBLOCK_R = add >> 4;
+    EEPROM_EEOFFSET_R = add & 0xF;
+    EEPROM_EERDWR_R = data;
+    while (EEPROM_EEDONE_R & EEPROM_EEDONE_WORKING);
+}
@@ -0,0 +1,185 @@
+// FEC Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Hardware configuration: -
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/fec.h"
+#include "inc/cycle.h"
+
+// Scramblers as s[n] = s[n - k] ^ s[n - m]
+#define ADD_M   7
+#define ADD_K   4
+#define MULT_M  23
+#define MULT_K  18
+
+static FEC_RATE rate = FEC_OFF;
+static SCRAMBLER scrambler = SCRAMBLE_OFF;
+
+// Running state
+static uint8_t encoderState = 0;        // last 6 input bits, newest in bit 0
+static uint32_t scramblerState = 0;
+static uint32_t inWord = 0;
+static uint8_t inBytes = 0;
+static uint64_t fifo = 0;               // coded bits, left aligned
+static uint8_t fifoBits = 0;
+
+void setFecRate(FEC_RATE r)
+{
+    rate = r;
+    resetFec();
+}
+
+FEC_RATE getFecRate(void)
+{
+    return rate;
+}
+
+void setScrambler(SCRAMBLER s)
+{
+    scrambler = s;
+    resetFec();
+}
+
+SCRAMBLER getScrambler(void)
+{
+    return scrambler;
+}
+
+bool fecActive(void)
+{
+    return rate != FEC_OFF || scrambler != SCRAMBLE_OFF;
+}
+
+// Zero encoder state, scramblers seeded with all ones
+void resetFec(void)
+{
+    encoderState = 0;
+    scramblerState = (scrambler == SCRAMBLE_ADDITIVE) ? (1 << ADD_M) - 1 : (1 << MULT_M) - 1;
+    inBytes = 0;
+    fifo = 0;
+    fifoBits = 0;
+}
+
+// 16 code bits of the next byte
+uint16_t convEncodeByte(uint8_t b)
+{
+    uint16_t out = fecStateTable[encoderState] ^ fecByteTable[b];
+    encoderState = b & 0x3F;
+    return out;
+}
+
+// Scramble a byte, MSB first: additive XORs the x^7 + x^4 + 1 sequence in
+// two 4 bit steps, multiplicative feeds the output back 8 bits per step
+uint8_t scrambleByte(uint8_t b)
+{
+    uint32_t s = scramblerState, chunk, seq = 0;
+    uint8_t i;
+    if (scrambler == SCRAMBLE_ADDITIVE)
+    {
+        for (i = 0; i < 2; i++)
+        {
+            chunk = ((s >> (ADD_K - 4)) ^ (s >> (ADD_M - 4))) & 0xF;
+            s = ((s << 4) | chunk) & ((1 << ADD_M) - 1);
+            seq = (seq << 4) | chunk;
+        }
+        b ^= seq;
+    }
+    else if (scrambler == SCRAMBLE_MULTIPLICATIVE)
+    {
+        b ^= (s >> (MULT_K - 8)) ^ (s >> (MULT_M - 8));
+        s = ((s << 8) | b) & ((1 << MULT_M) - 1);
+    }
+    scramblerState = s;
+    return b;
+}
+
+// Next source byte, MSB first out of the source words
+static uint8_t nextByte(uint32_t (*source)(void))
+{
+    if (inBytes == 0)
+    {
+        inWord = source();
+        inBytes = 4;
+    }
+    inBytes--;
+    return scrambleByte(inWord >> (8 * inBytes));
+}
+
+// Append n coded bits (right aligned) to the output FIFO
+static void push(uint32_t bits, uint8_t n)
+{
+    fifo |= (uint64_t) bits << (64 - fifoBits - n);
+    fifoBits += n;
+}
+
+// Next 32 coded bits, first in the MSB
+uint32_t nextFecWord(uint32_t (*source)(void))
+{
+    uint64_t code;
+    uint32_t out;
+    uint16_t c;
+    uint8_t i;
+    while (fifoBits < 32)
+    {
+        switch (rate)
+        {
+        case FEC_1_2:
+            push(convEncodeByte(nextByte(source)), 16);
+            break;
+        case FEC_2_3:
+            c = convEncodeByte(nextByte(source));
+            push((fecKeep23[c >> 12] << 9) | (fecKeep23[(c >> 8) & 0xF] << 6)
+               | (fecKeep23[(c >> 4) & 0xF] << 3) | fecKeep23[c & 0xF], 12);
+            break;
+        case FEC_3_4:
+            // Three bytes are eight 6 bit puncturing periods
+            code = (uint64_t) convEncodeByte(nextByte(source)) << 32;
+            code |= (uint32_t) convEncodeByte(nextByte(source)) << 16;
+            code |= convEncodeByte(nextByte(source));
+            out = 0;
+            for (i = 0; i < 8; i++)
+                out = (out << 4) | fecKeep34[(code >> (42 - 6 * i)) & 0x3F];
+            push(out, 32);
+            break;
+        default:
+            push(nextByte(source), 8);
+            break;
+        }
+    }
+    out = fifo >> 32;
+    fifo <<= 32;
+    fifoBits -= 32;
+    return out;
+}
+
+static uint32_t benchSource(void)
+{
+    return 0x5A5AC3C3;
+}
+
+// Cycles per source byte x100 at the current rate and scrambler
+uint32_t benchFec(void)
+{
+    uint32_t start, stop, bytes;
+    uint8_t i;
+    resetFec();
+    start = CYCLES();
+    for (i = 0; i < 64; i++)
+        nextFecWord(benchSource);
+    stop = CYCLES();
+    bytes = 64 * 4;
+    if (rate == FEC_1_2)
+        bytes = 64 * 2;
+    else if (rate == FEC_2_3)
+        bytes = 64 * 32 / 12;
+    else if (rate == FEC_3_4)
+        bytes = 64 * 3;
+    resetFec();
+    return ((stop - start) * 100) / bytes;
+}
@@ -0,0 +1,117 @@
+// FIR Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Hardware configuration: -
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/fir.h"
+#include "inc/dsp.h"
+#include "inc/cycle.h"
+#include "inc/ramexec.h"
+
+// Tap k of a phase, zero outside the filter
+static int16_t phaseTap(const int16_t* h, uint8_t n, uint8_t phases, uint8_t p, int16_t k)
+{
+    int16_t i = p + k * phases;
+    return (k < 0 || i >= n) ? 0 : h[i];
+}
+
+// Split n Q15 taps h into phases (h[p], h[p + phases], ...) and pack them
+// for both window alignments
+bool setFirTaps(FIR_BANK* b, const int16_t* h, uint8_t n, uint8_t phases)
+{
+    uint8_t taps, p, j;
+    if (phases == 0 || phases > FIR_PHASES_MAX)
+        return false;
+    taps = (n + phases - 1) / phases;
+    taps += taps & 1;
+    if (taps == 0 || taps > FIR_TAPS_MAX)
+        return false;
+    b->taps = taps;
+    b->phases = phases;
+    for (p = 0; p < phases; p++)
+        for (j = 0; j <= taps / 2; j++)
+        {
+            b->coef[p][0][j] = PACK16(phaseTap(h, n, phases, p, 2 * j), phaseTap(h, n, phases, p, 2 * j + 1));
+            b->coef[p][1][j] = PACK16(phaseTap(h, n, phases, p, 2 * j - 1), phaseTap(h, n, phases, p, 2 * j));
+        }
+    return true;
+}
+
+void resetFirLine(FIR_LINE* l)
+{
+    uint8_t i;
+    l->head = 0;
+    for (i = 0; i < FIR_TAPS_MAX; i++)
+        l->word[i] = 0;
+}
+
+RAMFUNC static void setHalf(uint32_t* word, uint8_t i, int16_t x)
+{
+    if (i & 1)
+        word[i >> 1] = (word[i >> 1] & 0xFFFF) | ((uint32_t) (uint16_t) x << 16);
+    else
+        word[i >> 1] = (word[i >> 1] & 0xFFFF0000) | (uint16_t) x;
+}
+
+// Newest input sample (one per output sample, or per L outputs when
+// interpolating), written at head and head + taps
+RAMFUNC void pushFir(const FIR_BANK* b, FIR_LINE* l, int16_t x)
+{
+    l->head = l->head ? l->head - 1 : b->taps - 1;
+    setHalf(l->word, l->head, x);
+    setHalf(l->word, l->head + b->taps, x);
+}
+
+// Output of one phase, sum h[j] x[n - j] rounded from Q15. For odd heads
+// the window starts one sample early against taps shifted by one.
+RAMFUNC int32_t firOutput(const FIR_BANK* b, const FIR_LINE* l, uint8_t phase)
+{
+    uint8_t odd = l->head & 1;
+    uint8_t words = (b->taps >> 1) + odd;
+    const uint32_t* c = b->coef[phase][odd];
+    const uint32_t* x = &l->word[l->head >> 1];
+    int32_t acc = Q15_ROUND;
+    for (; words >= 4; words -= 4)
+    {
+        acc = SMLAD(c[0], x[0], acc);
+        acc = SMLAD(c[1], x[1], acc);
+        acc = SMLAD(c[2], x[2], acc);
+        acc = SMLAD(c[3], x[3], acc);
+        c += 4;
+        x += 4;
+    }
+    while (words--)
+        acc = SMLAD(*c++, *x++, acc);
+    return acc >> 15;
+}
+
+// Cycles per tap x 100 over outputs outputs, interpolating through every
+// phase like the shaper does
+uint32_t benchFir(const FIR_BANK* b, uint16_t outputs)
+{
+    FIR_LINE l;
+    volatile int32_t sink;
+    uint32_t start, cycles;
+    uint16_t i;
+    uint8_t phase = 0;
+
+    resetFirLine(&l);
+    start = CYCLES();
+    for (i = 0; i < outputs; i++)
+    {
+        if (phase == 0)
+            pushFir(b, &l, i);
+        sink = firOutput(b, &l, phase);
+        if (++phase == b->phases)
+            phase = 0;
+    }
+    cycles = CYCLES() - start;
+    (void) sink;
+    return (uint64_t) cycles * 100 / ((uint32_t) outputs * b->taps);
+}
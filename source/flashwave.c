@@ -0,0 +1,119 @@
+// Flash Waveform Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Hardware configuration: -
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "inc/flashwave.h"
+#include "inc/adpcm.h"
+#include "inc/cycle.h"
+#include "inc/ramexec.h"
+
+static const WAVEFORM* wave = 0;
+static uint32_t nextBlock = 0;          // next block to decode
+static uint32_t blockCount = 0;
+
+// Double buffer shared with the sample ISR
+static uint32_t half[2][ADPCM_BLOCK];
+static uint16_t halfLength[2];
+static volatile bool halfReady[2];
+static uint8_t playing = 0;
+static uint16_t position = 0;
+static volatile uint32_t underruns = 0;
+
+int8_t findFlashWave(const char* name)
+{
+    uint8_t i;
+    for (i = 0; i < waveCount; i++)
+        if (strcmp(name, waveLibrary[i].name) == 0)
+            return i;
+    return -1;
+}
+
+// Decode the next block (looping) into a buffer half
+static void decodeNext(uint8_t h)
+{
+    uint32_t first = nextBlock * ADPCM_BLOCK;
+    uint16_t n = (wave->length - first < ADPCM_BLOCK) ? wave->length - first : ADPCM_BLOCK;
+    decodeAdpcmBlock(half[h], &wave->data[nextBlock * ADPCM_BLOCK_BYTES(ADPCM_BLOCK)], n);
+    halfLength[h] = n;
+    halfReady[h] = true;
+    if (++nextBlock == blockCount)
+        nextBlock = 0;
+}
+
+// Start a waveform with both halves primed, call with the mode stopped
+void selectFlashWave(uint8_t index)
+{
+    if (index >= waveCount)
+        return;
+    wave = &waveLibrary[index];
+    blockCount = (wave->length + ADPCM_BLOCK - 1) / ADPCM_BLOCK;
+    nextBlock = 0;
+    playing = 0;
+    position = 0;
+    underruns = 0;
+    decodeNext(0);
+    decodeNext(1);
+}
+
+// Main loop: refill whichever half the ISR has released, true if it did
+bool serviceFlashWave(void)
+{
+    uint8_t h;
+    bool decoded = false;
+    if (wave == 0)
+        return false;
+    for (h = 0; h < 2; h++)
+        if (!halfReady[h])
+        {
+            decodeNext(h);
+            decoded = true;
+        }
+    return decoded;
+}
+
+// Next sample, releases a half when it has been played out
+RAMFUNC void flashWaveSample(int32_t* sI, int32_t* sQ)
+{
+    uint32_t iq;
+    if (!halfReady[playing])
+    {
+        underruns++;
+        *sI = 0;
+        *sQ = 0;
+        return;
+    }
+    iq = half[playing][position];
+    *sI = (int16_t) iq;
+    *sQ = (int16_t) (iq >> 16);
+    if (++position == halfLength[playing])
+    {
+        halfReady[playing] = false;
+        playing ^= 1;
+        position = 0;
+    }
+}
+
+uint32_t getFlashWaveUnderruns(void)
+{
+    return underruns;
+}
+
+// Decode cost of one full block in cycles/sample x100 (first waveform)
+uint32_t benchFlashWave(void)
+{
+    static uint32_t scratch[ADPCM_BLOCK];
+    uint16_t n = (waveLibrary[0].length < ADPCM_BLOCK) ? waveLibrary[0].length : ADPCM_BLOCK;
+    uint32_t start, stop;
+    start = CYCLES();
+    decodeAdpcmBlock(scratch, waveLibrary[0].data, n);
+    stop = CYCLES();
+    return ((stop - start) * 100) / n;
+}
@@ -0,0 +1,91 @@
+// FSK Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Hardware configuration: -
+
+
+#include <stdint.h>
+#include <math.h>
+#include "inc/fsk.h"
+#include "inc/nco.h"
+#include "inc/modulator.h"
+#include "inc/ramexec.h"
+
+// Frequency words [symbol history][sample in symbol]
+static int32_t freqTable[1 << FSK_SPAN_MAX][SPS_MAX];
+static float pulse[FSK_SPAN_MAX * SPS_MAX];
+
+static uint8_t span = 1;
+static uint8_t samplesPerSymbol = 8;
+static uint8_t sampleCount = 0;
+static uint8_t history = 0;
+static uint32_t phase = 0;
+static int32_t fskGainI = 0, fskGainQ = 0;
+
+// Gaussian filtered rectangular frequency pulse of one symbol (T = 1)
+static float gaussianPulse(float t, float bt)
+{
+    float k = 2 * (float) M_PI * bt / sqrtf(2 * logf(2));
+    return 0.5f * (erff(k * (t + 0.5f)) - erff(k * (t - 0.5f)));
+}
+
+// CPFSK: param = modulation index h, MSK: h = 0.5, GMSK: h = 0.5, param = BT
+void setFsk(FSK_TYPE type, float param, uint8_t sps, int32_t gainI, int32_t gainQ)
+{
+    float h = (type == CPFSK) ? param : 0.5f;
+    float sum = 0, f;
+    uint16_t n, count;
+    uint8_t k, pattern;
+
+    if (sps == 0 || sps > SPS_MAX)
+        sps = SPS_MAX;
+    samplesPerSymbol = sps;
+    fskGainI = gainI;
+    fskGainQ = gainQ;
+
+    // Sampled pulse centred on the span, normalized to unit area
+    if (type == GMSK)
+        span = (param < 0.3f) ? 4 : (param < 0.5f) ? 3 : 2;
+    else
+        span = 1;
+    count = span * sps;
+    for (n = 0; n < count; n++)
+    {
+        pulse[n] = (type == GMSK) ? gaussianPulse((n + 0.5f) / sps - span / 2.0f, param) : 1;
+        sum += pulse[n];
+    }
+
+    // Each symbol advances the phase by +/- pi*h (2^31 = pi)
+    for (pattern = 0; pattern < (1 << span); pattern++)
+        for (n = 0; n < sps; n++)
+        {
+            f = 0;
+            for (k = 0; k < span; k++)
+                f += ((pattern >> k) & 1 ? 1 : -1) * pulse[k * sps + n];
+            freqTable[pattern][n] = (int32_t) llroundf(f / sum * h * 2147483648.0f);
+        }
+
+    resetFsk();
+}
+
+void resetFsk(void)
+{
+    sampleCount = 0;
+    history = 0;
+    phase = 0;
+}
+
+// Next baseband sample, newest symbol is bit 0 of the history
+RAMFUNC void fskSample(int32_t* sI, int32_t* sQ)
+{
+    if (sampleCount == 0)
+        history = ((history << 1) | nextSourceBits(1)) & ((1 << span) - 1);
+    phase += freqTable[history][sampleCount];
+    *sI = (ncoCos(phase) * fskGainI) >> 15;
+    *sQ = (ncoSin(phase) * fskGainQ) >> 15;
+    if (++sampleCount >= samplesPerSymbol)
+        sampleCount = 0;
+}
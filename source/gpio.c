@@ -12,6 +12,7 @@
 #include <stdbool.h>
 #include <tm4c123gh6pm.h>
 #include "inc/gpio.h"
+#include "inc/ramexec.h"
 
 // Bit offset of the registers relative to bit 0 of DATA_R at 3FCh
 // reg offset x 4 bytes / reg x 8 bits / byte
@@ -295,7 +296,7 @@ void clearPinInterrupt(PORT port, uint8_t pin)
     *p = 1;
 }
 
-void setPinValue(PORT port, uint8_t pin, bool value)
+RAMFUNC void setPinValue(PORT port, uint8_t pin, bool value)
 {
     uint32_t* p;
     p = (uint32_t*)port + pin;
@@ -0,0 +1,134 @@
+// Frequency Hopping Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Hardware configuration: -
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/hop.h"
+#include "inc/nco.h"
+#include "inc/dsp.h"
+#include "inc/ramexec.h"
+
+#define HOP_SCALE 23170                 // 1/sqrt(2) Q15, rotated corners stay inside the DAC
+
+static float hopFreq[HOP_MAX];          // Hz
+static uint32_t hopStep[HOP_MAX];       // words at the current sample rate
+static uint8_t hopCount = 0;
+static float sampleRate = 20000;
+static uint32_t dwell = 1000;
+static uint32_t guard = 0;
+
+// Running state, left counts the samples of the hop still to play
+static uint8_t current = 0;
+static uint32_t left = 1;
+static uint32_t step = 0;
+static uint32_t carrier = 0;
+
+// Table of carrier offsets in Hz, played in order and looped
+bool setHopTable(const float* f, uint8_t n)
+{
+    uint8_t i;
+    if (n == 0 || n > HOP_MAX)
+        return false;
+    for (i = 0; i < n; i++)
+        hopFreq[i] = f[i];
+    hopCount = n;
+    setHopRate(sampleRate);
+    return true;
+}
+
+// xorshift32, never returns 0 for a non-zero state
+static uint32_t nextRandom(uint32_t* s)
+{
+    *s ^= *s << 13;
+    *s ^= *s >> 17;
+    *s ^= *s << 5;
+    return *s;
+}
+
+// Pseudorandom order of channels spaced around DC (Fisher-Yates), every
+// channel is visited once per table pass
+bool generateHopTable(uint8_t channels, float spacing, uint32_t seed)
+{
+    float f[HOP_MAX], t;
+    uint32_t s = seed ? seed : 1;
+    uint8_t i, j;
+    if (channels == 0 || channels > HOP_MAX)
+        return false;
+    for (i = 0; i < channels; i++)
+        f[i] = (i - (channels - 1) / 2.0f) * spacing;
+    for (i = channels - 1; i > 0; i--)
+    {
+        j = nextRandom(&s) % (i + 1);
+        t = f[i];
+        f[i] = f[j];
+        f[j] = t;
+    }
+    return setHopTable(f, channels);
+}
+
+uint8_t getHopCount(void)
+{
+    return hopCount;
+}
+
+// Samples per hop and blanked samples at the start of each hop
+bool setHopDwell(uint32_t samples, uint32_t blank)
+{
+    if (samples == 0 || blank >= samples)
+        return false;
+    dwell = samples;
+    guard = blank;
+    resetHop();
+    return true;
+}
+
+// Recompute the frequency words, keeps offsets in Hz across rate changes
+void setHopRate(float fs)
+{
+    uint8_t i;
+    sampleRate = fs;
+    for (i = 0; i < hopCount; i++)
+        hopStep[i] = ncoFrequencyWord(hopFreq[i], fs);
+}
+
+// Restart at the first table entry, call with the mode stopped
+void resetHop(void)
+{
+    current = 0;
+    left = dwell;
+    step = hopStep[0];
+    carrier = 0;
+}
+
+// Rotate a baseband sample onto the current hop. The hop is taken once the
+// previous one has played all of its dwell, and the guard is tested before
+// counting the sample, so every hop (the first after a reset too) lasts
+// exactly dwell samples of which the first guard are blanked.
+RAMFUNC void hopSample(int32_t* sI, int32_t* sQ)
+{
+    uint32_t x, w;
+    if (left == 0)
+    {
+        left = dwell;
+        if (++current == hopCount)
+            current = 0;
+        step = hopStep[current];
+    }
+    carrier += step;
+    if (left-- > dwell - guard)
+    {
+        *sI = 0;
+        *sQ = 0;
+        return;
+    }
+    x = PACK16(*sI, *sQ);
+    w = PACK16((ncoCos(carrier) * HOP_SCALE) >> 15, (ncoSin(carrier) * HOP_SCALE) >> 15);
+    *sI = SMUSD(x, w) >> 15;
+    *sQ = SMUADX(x, w) >> 15;
+}
@@ -0,0 +1,29 @@
+// ADPCM Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// IMA-style 4-bit ADPCM for I/Q waveforms, one byte per I/Q pair.
+// Block layout (bytes):
+//   [0..1] I predictor (int16 LE)  [2] I step index
+//   [3..4] Q predictor (int16 LE)  [5] Q step index
+//   [6..)  one byte per pair, I code in bits 3:0, Q code in bits 7:4
+// Samples are DAC LSb around zero, scaled by 16 inside the codec to use
+// the step table's resolution. Shared by the firmware and tools/wavenc.c.
+
+
+#ifndef ADPCM_H_
+#define ADPCM_H_
+
+#include <stdint.h>
+
+#define ADPCM_BLOCK  256                // I/Q pairs per block
+#define ADPCM_HEADER 6
+#define ADPCM_BLOCK_BYTES(n) (ADPCM_HEADER + (n))
+#define ADPCM_SAMPLE_MAX 2047           // |sample| whose x16 fits the int16 predictor
+
+uint16_t encodeAdpcmBlock(uint8_t* out, const int16_t* sI, const int16_t* sQ, uint16_t n);
+void decodeAdpcmBlock(uint32_t* out, const uint8_t* in, uint16_t n);
+
+#endif
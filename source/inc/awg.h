@@ -0,0 +1,28 @@
+// AWG Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Arbitrary waveform playback from RAM. A Q16.16 phase accumulator walks
+// the waveform at any rate and wraps gaplessly; with interpolation on the
+// fractional part blends neighbouring samples linearly.
+
+
+#ifndef AWG_H_
+#define AWG_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define AWG_MAX 2048                    // I/Q pairs, shares SRAM with the OFDM blocks
+
+bool setAwgLength(uint16_t length);
+void clearAwg(void);
+uint16_t getAwgLength(void);
+void writeAwgSample(uint16_t index, int16_t sI, int16_t sQ);
+void setAwgRate(float step, bool interpolate);
+void resetAwg(void);
+void awgSample(int32_t* sI, int32_t* sQ);
+
+#endif
@@ -0,0 +1,39 @@
+// Chirp Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Phase continuous frequency sweeps on a second order phase accumulator:
+// every sample phase += freq and freq += rate, so a sample costs two adds
+// and the sine/cosine lookups. Logarithmic sweeps keep the same inner
+// loop and retarget rate every CHIRP_SEGMENT samples so the frequency
+// follows a geometric law piecewise linearly.
+
+
+#ifndef CHIRP_H_
+#define CHIRP_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define CHIRP_SEGMENT_BITS 5
+#define CHIRP_SEGMENT   (1 << CHIRP_SEGMENT_BITS)   // samples per log segment
+#define CHIRP_MARKER    CHIRP_SEGMENT               // marker pulse length, samples
+
+typedef enum _CHIRP_LAW
+{
+    LINEAR, LOGARITHMIC
+} CHIRP_LAW;
+
+typedef enum _CHIRP_REPEAT
+{
+    ONCE, REPEAT, UPDOWN
+} CHIRP_REPEAT;
+
+bool setChirp(float f0, float f1, float seconds, float fs, CHIRP_LAW law, CHIRP_REPEAT repeat,
+              int32_t gainI, int32_t gainQ);
+void resetChirp(void);
+bool chirpSample(int32_t* sI, int32_t* sQ);
+
+#endif
@@ -0,0 +1,58 @@
+// Configuration Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Operating configuration kept in EEPROM so the board boots straight into
+// the last saved mode. Packing is explicit per word so the record layout
+// does not depend on the compiler's struct layout; the EEPROM is only
+// reached through readEeprom/writeEeprom (stubbed for host builds).
+
+
+#ifndef CONFIG_H_
+#define CONFIG_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "output.h"
+#include "modulator.h"
+
+#define CONFIG_EEPROM_ADD   16          // block 1 onwards, block 0 is IQ calibration
+#define CONFIG_MAGIC        0x52464D43  // "RFMC"
+#define CONFIG_VERSION      4
+#define CONFIG_MAX_WORDS    48
+
+typedef struct _CONFIG
+{
+    uint8_t mode;                       // enum mode in main.c
+    bool filter;
+    bool tone;
+    bool differential;
+    float sampleRate;
+    int32_t freqI;                      // Hz
+    int32_t freqQ;
+    uint16_t rawI;                      // DAC codes for raw and dc
+    uint16_t rawQ;
+    OUTPUT_CHANNEL ch[2];
+    uint8_t scheme;                     // SCHEME of the symbol modes
+    uint8_t sps;
+    uint8_t payloadLength;              // 0 = symbol counter
+    char payload[PAYLOAD_MAX];
+    uint8_t fskType;                    // FSK_TYPE
+    float fskParam;                     // h (cpfsk) or BT (gmsk)
+    bool prbsSource;                    // PRBS bits instead of the payload
+    uint8_t prbsOrder;                  // O.150 polynomial of prbsPolys
+    uint32_t prbsSeed;
+    uint32_t prbsErrors;                // bits between injected errors, 0 = off
+    uint8_t fecRate;                    // FEC_RATE
+    uint8_t scrambler;                  // SCRAMBLER
+} CONFIG;
+
+uint16_t packConfig(const CONFIG* cfg, uint32_t* words);
+bool unpackConfig(CONFIG* cfg, const uint32_t* words, uint16_t count);
+void saveConfig(const CONFIG* cfg);
+bool loadConfig(CONFIG* cfg);
+void clearConfig(void);
+
+#endif
@@ -0,0 +1,47 @@
+// Constellation Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Table driven M-ary constellations (up to 256 points). Every scheme is a
+// list of complex points plus a Gray labelling, so the symbol mapper is the
+// same two lookups for all of them. Differential schemes accumulate the
+// mapped value as a phase index (diffMask), which any plain PSK can turn
+// on per transmission; offset schemes ask the symbol clock to stagger Q by
+// half a symbol.
+
+
+#ifndef CONSTELLATION_H_
+#define CONSTELLATION_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define CONSTELLATION_MAX 256
+
+typedef enum _SCHEME
+{
+    OOK, BPSK, QPSK, PSK8, QAM16, QAM64, QAM256, APSK16, APSK32, OQPSK, PI4DQPSK, SCHEME_COUNT
+} SCHEME;
+
+typedef struct _CONSTELLATION
+{
+    uint8_t bits;                       // bits per symbol
+    uint8_t mask;                       // (1 << bits) - 1
+    uint8_t pointMask;                  // number of points - 1
+    uint8_t diffMask;                   // 0 = absolute, else point index accumulates
+    bool offset;                        // Q lags I by half a symbol
+    bool psk;                           // point index is the phase index
+    uint8_t map[CONSTELLATION_MAX];     // symbol -> point index (Gray labelling)
+    uint32_t point[CONSTELLATION_MAX];  // PACK16(I, Q) in DAC LSb
+} CONSTELLATION;
+
+extern const char* schemeNames[SCHEME_COUNT];
+
+int8_t findScheme(const char* name);
+bool pskScheme(SCHEME scheme);
+void buildConstellation(CONSTELLATION* c, SCHEME scheme, int32_t gainI, int32_t gainQ);
+bool makeDifferential(CONSTELLATION* c, bool on);
+
+#endif
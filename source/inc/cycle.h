@@ -0,0 +1,25 @@
+// Cycle Counter Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// DWT cycle counter used for benchmarking the sample path, started from
+// ResetISR so boot times are counted from reset
+
+
+#ifndef CYCLE_H_
+#define CYCLE_H_
+
+#include <stdint.h>
+
+#define DWT_CTRL_R      (*((volatile uint32_t *)0xE0001000))
+#define DWT_CYCCNT_R    (*((volatile uint32_t *)0xE0001004))
+#define DWT_CTRL_CYCCNTENA  0x00000001
+#define DEMCR_TRCENA        0x01000000  // NVIC_DBG_INT_R
+
+#define CYCLES() DWT_CYCCNT_R
+
+void initCycleCounter(void);
+
+#endif
@@ -0,0 +1,29 @@
+// Deferred Work Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Lets interrupt handlers hand heavy work to PendSV, which runs at the
+// lowest priority once every other handler has returned: the handler
+// only sets a pending flag and pends PendSV. Work items are registered
+// once at init; a byte store per flag keeps deferWork safe from any
+// priority without locking, and work deferred again while it runs is
+// simply run once more.
+
+
+#ifndef DEFER_H_
+#define DEFER_H_
+
+#include <stdint.h>
+
+#define DEFER_MAX 4
+
+typedef void (*DEFERRED_WORK)(void);
+
+void initDeferredWork(uint8_t priority);
+int8_t addDeferredWork(DEFERRED_WORK work);
+void deferWork(uint8_t id);
+void pendSvIsr(void);
+
+#endif
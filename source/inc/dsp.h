@@ -0,0 +1,118 @@
+// DSP Intrinsics
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Cortex-M4 dual 16-bit SIMD instructions with bit-identical C versions
+// for compilers/targets without them (host builds)
+
+
+#ifndef DSP_H_
+#define DSP_H_
+
+#include <stdint.h>
+
+// Pack two 16-bit values into one word, lo in bits 15:0
+#define PACK16(lo, hi) ((uint32_t) (uint16_t) (lo) | ((uint32_t) (uint16_t) (hi) << 16))
+
+// Added before a >> 15 to round a Q15 product to nearest (ties up)
+#define Q15_ROUND 0x4000
+
+#if defined(__TI_ARM__)
+
+#define SMUAD(x, y)         _smuad(x, y)
+#define SMUADX(x, y)        _smuadx(x, y)
+#define SMUSD(x, y)         _smusd(x, y)
+#define SMLAD(x, y, acc)    _smlad(x, y, acc)
+#define SHADD16(x, y)       _shadd16(x, y)
+#define SHSUB16(x, y)       _shsub16(x, y)
+#define SHASX(x, y)         _shaddsubx(x, y)
+#define SHSAX(x, y)         _shsubaddx(x, y)
+
+#elif defined(__ARM_FEATURE_DSP)
+
+static inline int32_t SMUAD(uint32_t x, uint32_t y)
+{
+    int32_t r;
+    __asm volatile ("smuad %0, %1, %2" : "=r" (r) : "r" (x), "r" (y));
+    return r;
+}
+
+static inline int32_t SMLAD(uint32_t x, uint32_t y, int32_t acc)
+{
+    int32_t r;
+    __asm volatile ("smlad %0, %1, %2, %3" : "=r" (r) : "r" (x), "r" (y), "r" (acc));
+    return r;
+}
+
+#define DSP_ASM2(name, insn) \
+static inline uint32_t name(uint32_t x, uint32_t y) \
+{ \
+    uint32_t r; \
+    __asm volatile (insn " %0, %1, %2" : "=r" (r) : "r" (x), "r" (y)); \
+    return r; \
+}
+
+DSP_ASM2(SMUADX, "smuadx")
+DSP_ASM2(SMUSD, "smusd")
+DSP_ASM2(SHADD16, "shadd16")
+DSP_ASM2(SHSUB16, "shsub16")
+DSP_ASM2(SHASX, "shasx")
+DSP_ASM2(SHSAX, "shsax")
+
+#else
+
+#define DSP_LO(x) ((int32_t) (int16_t) (x))
+#define DSP_HI(x) ((int32_t) (int16_t) ((x) >> 16))
+
+// x.lo * y.lo + x.hi * y.hi
+static inline int32_t SMUAD(uint32_t x, uint32_t y)
+{
+    return DSP_LO(x) * DSP_LO(y) + DSP_HI(x) * DSP_HI(y);
+}
+
+// x.lo * y.hi + x.hi * y.lo
+static inline int32_t SMUADX(uint32_t x, uint32_t y)
+{
+    return DSP_LO(x) * DSP_HI(y) + DSP_HI(x) * DSP_LO(y);
+}
+
+// x.lo * y.lo - x.hi * y.hi
+static inline int32_t SMUSD(uint32_t x, uint32_t y)
+{
+    return DSP_LO(x) * DSP_LO(y) - DSP_HI(x) * DSP_HI(y);
+}
+
+// Halving lane-wise add/subtract
+static inline uint32_t SHADD16(uint32_t x, uint32_t y)
+{
+    return PACK16((DSP_LO(x) + DSP_LO(y)) >> 1, (DSP_HI(x) + DSP_HI(y)) >> 1);
+}
+
+static inline uint32_t SHSUB16(uint32_t x, uint32_t y)
+{
+    return PACK16((DSP_LO(x) - DSP_LO(y)) >> 1, (DSP_HI(x) - DSP_HI(y)) >> 1);
+}
+
+// lo = (x.lo - y.hi) / 2, hi = (x.hi + y.lo) / 2
+static inline uint32_t SHASX(uint32_t x, uint32_t y)
+{
+    return PACK16((DSP_LO(x) - DSP_HI(y)) >> 1, (DSP_HI(x) + DSP_LO(y)) >> 1);
+}
+
+// lo = (x.lo + y.hi) / 2, hi = (x.hi - y.lo) / 2
+static inline uint32_t SHSAX(uint32_t x, uint32_t y)
+{
+    return PACK16((DSP_LO(x) + DSP_HI(y)) >> 1, (DSP_HI(x) - DSP_LO(y)) >> 1);
+}
+
+// acc + x.lo * y.lo + x.hi * y.hi
+static inline int32_t SMLAD(uint32_t x, uint32_t y, int32_t acc)
+{
+    return acc + SMUAD(x, y);
+}
+
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// EEPROM Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Hardware configuration:
+// 2 KB on-chip EEPROM, 32 blocks of 16 words, addressed here by word
+
+
+#ifndef EEPROM_H_
+#define EEPROM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define EEPROM_WORDS 512
+
+bool initEeprom(void);
+uint32_t readEeprom(uint16_t add);
+void writeEeprom(uint16_t add, uint32_t data);
+
+#endif
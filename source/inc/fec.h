@@ -0,0 +1,52 @@
+// FEC Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Optional channel coding in front of the mapper:
+//   source bytes -> scrambler -> K=7 r=1/2 convolutional code (171, 133)
+//     -> puncturing to 2/3 or 3/4
+// The encoder is linear, so a whole byte is coded with two lookups:
+// fecStateTable[last 6 bits] ^ fecByteTable[byte] gives its 16 code bits (G1
+// bit first per input bit). Puncturing compacts groups of code bits
+// (A1 B1 A2 B2 -> A1 B1 A2 for 2/3, A1 B1 A2 B2 A3 B3 -> A1 B1 A2 B3 for
+// 3/4, as in 802.11a) with one small table lookup per group.
+// Scramblers: additive x^7 + x^4 + 1 (802.11) and self synchronizing
+// multiplicative 1 + x^-18 + x^-23 (V.32), both a byte per step or two.
+
+
+#ifndef FEC_H_
+#define FEC_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef enum _FEC_RATE
+{
+    FEC_OFF, FEC_1_2, FEC_2_3, FEC_3_4
+} FEC_RATE;
+
+typedef enum _SCRAMBLER
+{
+    SCRAMBLE_OFF, SCRAMBLE_ADDITIVE, SCRAMBLE_MULTIPLICATIVE
+} SCRAMBLER;
+
+// Coding tables, const in tables.c (generated by tools/tablegen.c)
+extern const uint16_t fecStateTable[64];
+extern const uint16_t fecByteTable[256];
+extern const uint8_t fecKeep23[16];
+extern const uint8_t fecKeep34[64];
+
+void setFecRate(FEC_RATE rate);
+FEC_RATE getFecRate(void);
+void setScrambler(SCRAMBLER s);
+SCRAMBLER getScrambler(void);
+bool fecActive(void);
+void resetFec(void);
+uint16_t convEncodeByte(uint8_t b);
+uint8_t scrambleByte(uint8_t b);
+uint32_t nextFecWord(uint32_t (*source)(void));
+uint32_t benchFec(void);
+
+#endif
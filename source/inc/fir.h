@@ -0,0 +1,47 @@
+// FIR Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Q15 FIR and polyphase interpolating FIR on the SMLAD dual MAC. Taps are
+// packed in pairs, the delay line is written twice so the newest window is
+// always contiguous, and a second copy of the taps shifted by one covers
+// windows starting on an odd sample, so the inner loop is one word load of
+// taps, one of samples and one SMLAD per two taps, unrolled by four. About
+// 1.5 cycles per tap plus call overhead on the M4; "filter bench" measures
+// it. Host builds use the bit-identical C SMLAD of dsp.h.
+
+
+#ifndef FIR_H_
+#define FIR_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define FIR_TAPS_MAX    32              // per phase
+#define FIR_PHASES_MAX  4
+
+// Taps split into phases, [phase][window alignment][pair]
+typedef struct _FIR_BANK
+{
+    uint8_t taps;                       // per phase, rounded up to even
+    uint8_t phases;                     // 1 = plain FIR, L = interpolate by L
+    uint32_t coef[FIR_PHASES_MAX][2][FIR_TAPS_MAX / 2 + 1];
+} FIR_BANK;
+
+// Delay line, sample j of the window is x[n - j]; packed pairs, even
+// positions in the low half
+typedef struct _FIR_LINE
+{
+    uint8_t head;
+    uint32_t word[FIR_TAPS_MAX];
+} FIR_LINE;
+
+bool setFirTaps(FIR_BANK* b, const int16_t* h, uint8_t n, uint8_t phases);
+void resetFirLine(FIR_LINE* l);
+void pushFir(const FIR_BANK* b, FIR_LINE* l, int16_t x);
+int32_t firOutput(const FIR_BANK* b, const FIR_LINE* l, uint8_t phase);
+uint32_t benchFir(const FIR_BANK* b, uint16_t outputs);
+
+#endif
@@ -0,0 +1,36 @@
+// Flash Waveform Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Long waveforms stored ADPCM compressed in flash (wavedata.c, generated
+// by tools/wavenc.c) and streamed block by block: the main loop decodes
+// the next block into one half of a double buffer while the sample ISR
+// plays the other half.
+
+
+#ifndef FLASHWAVE_H_
+#define FLASHWAVE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef struct _WAVEFORM
+{
+    const char* name;
+    uint32_t length;                    // I/Q pairs
+    const uint8_t* data;                // ADPCM blocks of ADPCM_BLOCK pairs
+} WAVEFORM;
+
+extern const WAVEFORM waveLibrary[];
+extern const uint8_t waveCount;
+
+int8_t findFlashWave(const char* name);
+void selectFlashWave(uint8_t index);
+bool serviceFlashWave(void);
+void flashWaveSample(int32_t* sI, int32_t* sQ);
+uint32_t getFlashWaveUnderruns(void);
+uint32_t benchFlashWave(void);
+
+#endif
@@ -0,0 +1,30 @@
+// FSK Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Continuous phase FSK family (CPFSK, MSK, GMSK) on a phase accumulator.
+// Binary symbols from the modulator bit source select a precomputed
+// frequency word per sample: the table holds the sum of the frequency
+// pulses of the last L symbols for every L-bit history, so a sample costs
+// one lookup and one accumulate regardless of the pulse length.
+
+
+#ifndef FSK_H_
+#define FSK_H_
+
+#include <stdint.h>
+
+#define FSK_SPAN_MAX 4                  // symbols covered by the Gaussian pulse
+
+typedef enum _FSK_TYPE
+{
+    CPFSK, MSK, GMSK
+} FSK_TYPE;
+
+void setFsk(FSK_TYPE type, float param, uint8_t sps, int32_t gainI, int32_t gainQ);
+void resetFsk(void);
+void fskSample(int32_t* sI, int32_t* sQ);
+
+#endif
@@ -0,0 +1,30 @@
+// Frequency Hopping Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// FHSS on top of any baseband mode: the baseband sample is rotated by a
+// carrier NCO whose increment is swapped for the next hop table entry
+// every dwell samples, so a hop lands on an exact sample and costs one
+// load. The carrier phase runs on across hops and the modulator never
+// stops; an optional guard blanks the first samples of each dwell.
+
+
+#ifndef HOP_H_
+#define HOP_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define HOP_MAX 64                      // hop table entries
+
+bool setHopTable(const float* f, uint8_t n);
+bool generateHopTable(uint8_t channels, float spacing, uint32_t seed);
+uint8_t getHopCount(void);
+bool setHopDwell(uint32_t samples, uint32_t guard);
+void setHopRate(float fs);
+void resetHop(void);
+void hopSample(int32_t* sI, int32_t* sQ);
+
+#endif
@@ -0,0 +1,27 @@
+// IQ Calibration Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Builds the output stage correction from shell parameters and keeps it in
+// EEPROM so each board boots with its own analog chain calibration
+
+
+#ifndef IQCAL_H_
+#define IQCAL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define IQCAL_EEPROM_ADD   0            // words 0..7
+
+void setIqMatrix(float a, float b, float c, float d, int32_t offsetI, int32_t offsetQ);
+void setIqImbalance(float gainDb, float skewDeg, int32_t offsetI, int32_t offsetQ);
+void resetIqCorrection(void);
+void getIqMatrix(float m[4], int32_t* offsetI, int32_t* offsetQ);
+void saveIqCorrection(void);
+bool loadIqCorrection(void);
+uint32_t benchIqCorrection(uint16_t n);
+
+#endif
@@ -0,0 +1,62 @@
+// CPU Load Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// CPU time split by where it was spent, from the DWT cycle counter. Every
+// handler and every main loop pass is bracketed by a mark; a mark charges
+// its source only the cycles not already charged to handlers that nested
+// inside it, so the sources add up to the elapsed time without double
+// counting. Each source has a single writer, no locking needed. Main loop
+// passes that found nothing to do are idle, everything else is load.
+// Counters wrap at 2^32 cycles (107 s at 40 MHz), intervals stay below.
+
+
+#ifndef LOAD_H_
+#define LOAD_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Handlers in priority order, then the main loop
+typedef enum _LOAD_SOURCE
+{
+    LOAD_SAMPLE,                        // sample ISR
+    LOAD_UART,                          // UART receive ISR
+    LOAD_DEFER,                         // PendSV deferred work (block generation)
+    LOAD_SERVICE,                       // main loop decode/build ahead
+    LOAD_SHELL,                         // main loop command handling
+    LOAD_IDLE,                          // main loop with nothing to do
+    LOAD_SOURCES
+} LOAD_SOURCE;
+
+typedef struct _LOAD_MARK
+{
+    uint32_t start;                     // cycle counter
+    uint32_t nested;                    // all sources at start
+} LOAD_MARK;
+
+// One closed interval
+typedef struct _LOAD_REPORT
+{
+    uint32_t cycles;
+    uint32_t samples;                   // sample ISR runs
+    uint32_t source[LOAD_SOURCES];
+} LOAD_REPORT;
+
+void initLoad(uint32_t intervalCycles);
+void setLoadInterval(uint32_t intervalCycles);
+uint32_t getLoadInterval(void);
+void beginLoad(LOAD_MARK* m);
+void endLoad(const LOAD_MARK* m, LOAD_SOURCE s);
+uint32_t getLoadExclusive(const LOAD_MARK* m);
+void countLoadSample(void);
+bool updateLoad(void);
+const LOAD_REPORT* getLoad(void);
+uint16_t getLoadPercent(const LOAD_REPORT* r, LOAD_SOURCE s);
+uint16_t getLoadTotal(void);
+uint16_t getLoadPeak(void);
+void resetLoadPeak(void);
+
+#endif
@@ -0,0 +1,48 @@
+// Modulator Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Symbol path of the digital modes:
+//   bit source (packet, PRBS, payload or counter) -> (scrambler, FEC)
+//     -> constellation mapper -> (RRC shaper) -> baseband I/Q
+// A symbol is fetched every samplesPerSymbol samples, in between the
+// symbol is held or, with shaping on, zero stuffed into the RRC filter.
+// I and Q run on their own rail clocks so offset schemes (OQPSK) get a
+// sample-exact half symbol stagger at no extra cost.
+
+
+#ifndef MODULATOR_H_
+#define MODULATOR_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "constellation.h"
+#include "rrc.h"
+
+#define PAYLOAD_MAX 64                  // bytes
+#define SPS_MAX     16
+
+void setScheme(SCHEME scheme, int32_t gainI, int32_t gainQ);
+SCHEME getScheme(void);
+uint8_t getBitsPerSymbol(void);
+bool setDifferential(bool on);
+bool getDifferential(void);
+void setPayload(const char* data, uint8_t length);
+uint8_t getPayload(char* data);
+void setPrbsSource(bool on);
+bool getPrbsSource(void);
+void setPacketSource(bool on);
+bool setSamplesPerSymbol(uint8_t sps);
+uint8_t getSamplesPerSymbol(void);
+uint8_t getShaperDelay(void);
+void setShaping(bool on);
+uint32_t benchShaper(void);
+void resetModulator(void);
+void modulatorSample(int32_t* sI, int32_t* sQ);
+uint32_t nextSourceBits(uint8_t bits);
+uint32_t mapNextSymbol(void);
+uint32_t getSymbolPower(void);
+
+#endif
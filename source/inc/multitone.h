@@ -0,0 +1,38 @@
+// Multitone Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Sum of up to MULTITONE_MAX complex tones, each on its own phase
+// accumulator. Tones are processed in pairs: two table lookups are packed
+// into one word and accumulated against a packed amplitude pair with one
+// dual multiply-accumulate per rail. Tones without an explicit phase get
+// Newman phases pi (k - 1)^2 / N, and the amplitudes are scaled so the
+// simulated peak of the sum just fits the DAC. The simulation covers the
+// common period of the tones when it is at most CREST_SAMPLES, which makes
+// the peak exact; otherwise it is an estimate from the first CREST_SAMPLES
+// samples, and a later higher peak is absorbed by CREST_MARGIN or clipped
+// by the DAC saturation.
+
+
+#ifndef MULTITONE_H_
+#define MULTITONE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define MULTITONE_MAX   16
+#define CREST_SAMPLES   4096            // most samples simulated to find the peak
+
+bool addTone(float f, float amplitude, float degrees, bool newman);
+void clearTones(void);
+uint8_t getToneCount(void);
+void setMultitone(float fs, int32_t gainI, int32_t gainQ);
+float getCrestFactor(void);
+bool getCrestExact(void);
+void resetMultitone(void);
+void multitoneSample(int32_t* sI, int32_t* sQ);
+uint32_t benchMultitone(uint8_t n);
+
+#endif
@@ -0,0 +1,38 @@
+// NCO Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Numerically controlled oscillator shared by the tone generating modes
+//   32-bit phase accumulator, top 12 bits index a Q15 sine table
+//   (const in tables.c, generated by tools/tablegen.c)
+
+
+#ifndef NCO_H_
+#define NCO_H_
+
+#include <stdint.h>
+
+#define NCO_BITS    12
+#define NCO_SIZE    (1 << NCO_BITS)
+#define NCO_SHIFT   (32 - NCO_BITS)
+#define NCO_QUARTER 0x40000000          // 90 degrees of phase
+
+extern const int16_t sineTable[NCO_SIZE];
+
+uint32_t ncoFrequencyWord(float f, float fs);
+uint32_t ncoPhaseWord(float degrees);
+
+// Q15 sine and cosine of a 32-bit phase
+static inline int32_t ncoSin(uint32_t phase)
+{
+    return sineTable[phase >> NCO_SHIFT];
+}
+
+static inline int32_t ncoCos(uint32_t phase)
+{
+    return sineTable[(phase + NCO_QUARTER) >> NCO_SHIFT];
+}
+
+#endif
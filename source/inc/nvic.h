@@ -14,5 +14,7 @@
 void enableNvicInterrupt(uint8_t vectorNumber);
 void disableNvicInterrupt(uint8_t vectorNumber);
 void setNvicInterruptPriority(uint8_t vectorNumber, uint8_t priority);
+void setNvicPendSvPriority(uint8_t priority);
+void pendNvicPendSv(void);
 
 #endif
@@ -0,0 +1,35 @@
+// OFDM Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// OFDM baseband: data subcarriers are fed from the modulator's mapper
+// (scheme and payload of the mod command), pilots are inserted every
+// OFDM_PILOT_STEP carriers, and each symbol is built by a Q15 mixed
+// radix-4/2 IFFT with a cyclic prefix. Symbols are computed in the main
+// loop into a double buffered block, the sample ISR only streams them.
+
+
+#ifndef OFDM_H_
+#define OFDM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define OFDM_MAX        256
+#define OFDM_CP_MAX     (OFDM_MAX / 4)
+#define OFDM_PILOT_STEP 14              // pilots at +-7, +-21, ... like 802.11a at N = 64
+
+bool setOfdm(uint16_t size, uint16_t cp, int32_t gainI);
+uint16_t getOfdmSize(void);
+uint16_t getOfdmPrefix(void);
+uint16_t getOfdmCarriers(void);
+void resetOfdm(void);
+bool serviceOfdm(void);
+void ofdmSample(int32_t* sI, int32_t* sQ);
+uint32_t getOfdmUnderruns(void);
+void ifftQ15(uint32_t* x, uint16_t n);
+void benchOfdm(uint32_t* ifftCycles, uint32_t* symbolCycles);
+
+#endif
@@ -0,0 +1,82 @@
+// Output Stage Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// IQ correction (2x2 matrix + offset) and per-channel gain, phase and DC
+// offset applied to every modulated sample before it is written to the DAC.
+// Settings are double buffered so that an update from the shell takes effect
+// as a whole on the next sample.
+
+
+#ifndef OUTPUT_H_
+#define OUTPUT_H_
+
+#include <stdint.h>
+#include "dsp.h"
+
+#define OUT_I 0
+#define OUT_Q 1
+
+#define DAC_MID   2135                  // DAC code of the analog zero
+#define DAC_MAX   4095
+#define Q15_ONE   32768                 // unity gain
+
+typedef struct _OUTPUT_CHANNEL
+{
+    int32_t gain;                       // Q15, Q15_ONE = unity
+    uint32_t phase;                     // added to the sine phase accumulator (sine mode only)
+    int32_t offset;                     // DC offset in DAC LSb
+} OUTPUT_CHANNEL;
+
+// Corrects the analog chain: I' = a*I + b*Q + oI, Q' = c*I + d*Q + oQ
+typedef struct _OUTPUT_CORRECTION
+{
+    uint32_t rowI;                      // packed Q15 (a, b)
+    uint32_t rowQ;                      // packed Q15 (c, d)
+    int32_t offsetI;                    // DAC LSb
+    int32_t offsetQ;
+} OUTPUT_CORRECTION;
+
+typedef struct _OUTPUT_STAGE
+{
+    OUTPUT_CORRECTION corr;
+    OUTPUT_CHANNEL ch[2];
+} OUTPUT_STAGE;
+
+extern OUTPUT_STAGE outputStage[2];
+extern volatile uint8_t outputActive;
+
+void initOutputStage(void);
+void setOutputChannel(uint8_t channel, int32_t gain, uint32_t phase, int32_t offset);
+void setOutputCorrection(const OUTPUT_CORRECTION* corr);
+
+// Settings in effect for the current sample
+static inline const OUTPUT_STAGE* getOutputStage(void)
+{
+    return &outputStage[outputActive];
+}
+
+// Apply the correction matrix to a baseband pair, two SMLADs per sample
+static inline void correctSample(const OUTPUT_CORRECTION* c, int32_t* sI, int32_t* sQ)
+{
+    uint32_t iq = PACK16(*sI, *sQ);
+    *sI = (SMLAD(c->rowI, iq, Q15_ROUND) >> 15) + c->offsetI;
+    *sQ = (SMLAD(c->rowQ, iq, Q15_ROUND) >> 15) + c->offsetQ;
+}
+
+// Scale (rounded to nearest) and offset a signed baseband sample (DAC LSb
+// around zero) into a saturated 12-bit DAC code. The analog chain inverts,
+// hence DAC_MID - y.
+static inline uint16_t outputSample(const OUTPUT_CHANNEL* c, int32_t x)
+{
+    int32_t y = DAC_MID - (((x * c->gain + Q15_ROUND) >> 15) + c->offset);
+    if (y < 0)
+        y = 0;
+    if (y > DAC_MAX)
+        y = DAC_MAX;
+    return y;
+}
+
+#endif
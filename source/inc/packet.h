@@ -0,0 +1,35 @@
+// Packet Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Burst transmission: preamble + sync word + payload (+ CRC-16) is
+// assembled into a frame buffer from the shell (payload through the FEC
+// stage when enabled), then the sample ISR plays it as the modulator bit
+// source. Each burst ramps in and out with a raised cosine envelope and is
+// followed by a gap of idle (DAC mid-scale) symbols, so the sample path
+// stays a counter compare and one multiply.
+
+
+#ifndef PACKET_H_
+#define PACKET_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define PACKET_PREAMBLE_MAX 16          // bytes of 0xAA
+#define PACKET_MAX      192             // frame bytes after coding
+#define PACKET_RAMP_MAX 64              // samples
+#define PACKET_SYNC     0x1ACFFC1D      // CCSDS attached sync marker
+
+bool setPacketFormat(uint8_t preamble, uint32_t sync, bool crc);
+bool setPacketTiming(uint16_t gap, uint8_t ramp);
+bool buildPacket(const uint8_t* data, uint8_t length);
+bool rebuildPacket(void);
+uint16_t getPacketBits(void);
+uint32_t nextPacketWord(void);
+void resetPacket(void);
+void packetSample(int32_t* sI, int32_t* sQ);
+
+#endif
@@ -0,0 +1,38 @@
+// PRBS Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// ITU-T O.150 pseudorandom bit sequences x^m + x^k + 1 generated a word
+// at a time: with the last m bits in a register, the next w <= k bits are
+// (s >> (k - w)) ^ (s >> (m - w)) in one step, so a 32-bit word costs
+// 32 / k shift/xor steps instead of 32 single bit updates. Errors can be
+// injected at a fixed bit interval for BER test setups.
+
+
+#ifndef PRBS_H_
+#define PRBS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef struct _PRBS_POLY
+{
+    uint8_t order;                      // m
+    uint8_t tap;                        // k
+    bool invert;                        // O.150 transmits PRBS15/23/31 inverted
+} PRBS_POLY;
+
+extern const PRBS_POLY prbsPolys[];
+extern const uint8_t prbsPolyCount;
+
+int8_t findPrbs(uint8_t order);
+bool setPrbs(const PRBS_POLY* poly, uint32_t seed);
+const PRBS_POLY* getPrbs(uint32_t* seed);
+void setPrbsErrors(uint32_t interval);
+uint32_t getPrbsErrors(void);
+void resetPrbs(void);
+uint32_t nextPrbsWord(void);
+
+#endif
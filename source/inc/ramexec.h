@@ -0,0 +1,33 @@
+// RAM Execution
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Placement of the per-sample path. Built with RAM_EXEC defined for both
+// the compiler and the linker (--define=RAM_EXEC in each), functions marked
+// RAMFUNC and tables marked RAMCONST load from flash and run from SRAM:
+// tm4c123gh6pm.cmd puts them in copy table sections the boot routine
+// copies (BINIT) before main(). Without it, and in host builds, the marks
+// are empty and everything runs from flash.
+// The flash is zero wait state up to 40 MHz; above, fetches past the
+// prefetch buffer stall, which branchy ISR code hits most. "exec" times the
+// current mode's sample path in cycles for comparing two builds. Only the
+// per-sample functions are marked so the copy fits beside .bss and the
+// stack; the 8 KB sine table stays in flash.
+
+
+#ifndef RAMEXEC_H_
+#define RAMEXEC_H_
+
+#if defined(RAM_EXEC) && defined(__TI_ARM__)
+#define RAMFUNC     __attribute__((ramfunc))
+#define RAMCONST    __attribute__((section(".ramconst")))
+#define EXEC_MEMORY "sram"
+#else
+#define RAMFUNC
+#define RAMCONST
+#define EXEC_MEMORY "flash"
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// RRC Filter Taps
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Root raised cosine pulse shared by the modulator's shaper and the host
+// reference receiver (tools/rxref.c), which uses it as the matched filter.
+// Q15 taps, the shaper renormalizes them per polyphase branch.
+
+
+#ifndef RRC_H_
+#define RRC_H_
+
+#include <stdint.h>
+
+#define RRC_TAPS    31
+#define RRC_SPS     4                   // samples/symbol the RRC taps were designed for
+#define RRC_SYMBOLS ((RRC_TAPS + RRC_SPS - 1) / RRC_SPS)    // taps per polyphase branch
+
+extern const int16_t rrcTaps[RRC_TAPS];
+
+#endif
@@ -0,0 +1,34 @@
+// Sample Stream Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Ring buffer of ready-to-send DAC word pairs between a block generator at
+// low priority and the sample ISR. The generator runs a mode's per-sample
+// code STREAM_BLOCK samples at a time whenever a block is free, so its
+// per-call overhead is amortized and a slow sample is absorbed by the
+// fill level; the ISR only copies the next pair to the SPI FIFO. One
+// writer (generator) and one reader (ISR), no locking needed.
+
+
+#ifndef STREAM_H_
+#define STREAM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define STREAM_SIZE  256                // word pairs, power of two
+#define STREAM_BLOCK 64                 // samples per generator pass
+
+// Next pair of SPI words, Q word in bits 15:0 (sent first), I in 31:16
+typedef uint32_t (*STREAM_SOURCE)(void);
+
+void resetStream(void);
+uint16_t getStreamFree(void);
+uint16_t getStreamLevel(void);
+void fillStream(STREAM_SOURCE source, uint16_t n);
+bool readStream(uint32_t* pair);
+uint32_t getStreamUnderruns(void);
+
+#endif
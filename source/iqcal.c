@@ -0,0 +1,137 @@
+// IQ Calibration Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Hardware configuration: -
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include "inc/iqcal.h"
+#include "inc/output.h"
+#include "inc/eeprom.h"
+#include "inc/cycle.h"
+
+#define IQCAL_MAGIC 0x49514331          // "IQC1"
+
+// Saturating float to Q15 conversion
+static int16_t toQ15(float x)
+{
+    int32_t q = lroundf(x * 32768);
+    if (q > 32767)
+        q = 32767;
+    if (q < -32768)
+        q = -32768;
+    return q;
+}
+
+static float fromQ15(uint16_t q)
+{
+    return (int16_t) q / 32768.0f;
+}
+
+// Set the correction matrix directly, coefficients in [-1, 1)
+void setIqMatrix(float a, float b, float c, float d, int32_t offsetI, int32_t offsetQ)
+{
+    OUTPUT_CORRECTION corr;
+    corr.rowI = PACK16(toQ15(a), toQ15(b));
+    corr.rowQ = PACK16(toQ15(c), toQ15(d));
+    corr.offsetI = offsetI;
+    corr.offsetQ = offsetQ;
+    setOutputCorrection(&corr);
+}
+
+// Pre-distort for a Q path with gain error gainDb and skew skewDeg relative
+// to I, i.e. the inverse of [1 0; g*sin(p) g*cos(p)]. The matrix is normalized
+// so its largest coefficient fits Q15, the stronger path is attenuated.
+void setIqImbalance(float gainDb, float skewDeg, int32_t offsetI, int32_t offsetQ)
+{
+    float g = powf(10, gainDb / 20);
+    float p = skewDeg * (float) M_PI / 180;
+    float c = -tanf(p);
+    float d = 1 / (g * cosf(p));
+    float m = 1;
+    if (fabsf(c) > m)
+        m = fabsf(c);
+    if (fabsf(d) > m)
+        m = fabsf(d);
+    setIqMatrix(1 / m, 0, c / m, d / m, offsetI, offsetQ);
+}
+
+void resetIqCorrection(void)
+{
+    setIqMatrix(1, 0, 0, 1, 0, 0);
+}
+
+void getIqMatrix(float m[4], int32_t* offsetI, int32_t* offsetQ)
+{
+    const OUTPUT_CORRECTION* corr = &getOutputStage()->corr;
+    m[0] = fromQ15(corr->rowI);
+    m[1] = fromQ15(corr->rowI >> 16);
+    m[2] = fromQ15(corr->rowQ);
+    m[3] = fromQ15(corr->rowQ >> 16);
+    *offsetI = corr->offsetI;
+    *offsetQ = corr->offsetQ;
+}
+
+// Record: magic, rowI, rowQ, offsetI, offsetQ, checksum
+void saveIqCorrection(void)
+{
+    const OUTPUT_CORRECTION* corr = &getOutputStage()->corr;
+    uint32_t sum = IQCAL_MAGIC + corr->rowI + corr->rowQ + corr->offsetI + corr->offsetQ;
+    writeEeprom(IQCAL_EEPROM_ADD + 0, IQCAL_MAGIC);
+    writeEeprom(IQCAL_EEPROM_ADD + 1, corr->rowI);
+    writeEeprom(IQCAL_EEPROM_ADD + 2, corr->rowQ);
+    writeEeprom(IQCAL_EEPROM_ADD + 3, corr->offsetI);
+    writeEeprom(IQCAL_EEPROM_ADD + 4, corr->offsetQ);
+    writeEeprom(IQCAL_EEPROM_ADD + 5, ~sum);
+}
+
+// Restore a saved correction, leaves the current one if none is stored
+bool loadIqCorrection(void)
+{
+    OUTPUT_CORRECTION corr;
+    uint32_t sum;
+    if (readEeprom(IQCAL_EEPROM_ADD) != IQCAL_MAGIC)
+        return false;
+    corr.rowI = readEeprom(IQCAL_EEPROM_ADD + 1);
+    corr.rowQ = readEeprom(IQCAL_EEPROM_ADD + 2);
+    corr.offsetI = readEeprom(IQCAL_EEPROM_ADD + 3);
+    corr.offsetQ = readEeprom(IQCAL_EEPROM_ADD + 4);
+    sum = IQCAL_MAGIC + corr.rowI + corr.rowQ + corr.offsetI + corr.offsetQ;
+    if (readEeprom(IQCAL_EEPROM_ADD + 5) != ~sum)
+        return false;
+    setOutputCorrection(&corr);
+    return true;
+}
+
+// Cycles per sample of the correction stage over n sample pairs, x100
+uint32_t benchIqCorrection(uint16_t n)
+{
+    const OUTPUT_CORRECTION* corr = &getOutputStage()->corr;
+    volatile int32_t sink;
+    int32_t sI, sQ;
+    uint32_t start, stop, empty;
+    uint16_t i;
+
+    // Loop overhead alone
+    start = CYCLES();
+    for (i = 0; i < n; i++)
+        sink = i;
+    empty = CYCLES() - start;
+
+    start = CYCLES();
+    for (i = 0; i < n; i++)
+    {
+        sI = i;
+        sQ = -i;
+        correctSample(corr, &sI, &sQ);
+        sink = sI + sQ;
+    }
+    stop = CYCLES();
+    (void) sink;
+    return ((stop - start - empty) * 100) / n;
+}
@@ -0,0 +1,145 @@
+// CPU Load Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Hardware configuration: -
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/load.h"
+#include "inc/cycle.h"
+#include "inc/ramexec.h"
+
+static volatile uint32_t charged[LOAD_SOURCES];
+static volatile uint32_t samples = 0;
+static uint32_t interval;
+static uint32_t windowStart, windowSamples;
+static uint32_t windowCharged[LOAD_SOURCES];
+static LOAD_REPORT last;
+static uint16_t total = 0, peak = 0;
+
+RAMFUNC static uint32_t sumCharged(void)
+{
+    uint32_t s = 0;
+    uint8_t i;
+    for (i = 0; i < LOAD_SOURCES; i++)
+        s += charged[i];
+    return s;
+}
+
+// Cycle counter and charged total at the same instant: retried if a
+// handler charged something in between
+RAMFUNC static uint32_t snapshot(uint32_t* now)
+{
+    uint32_t s;
+    do
+    {
+        s = sumCharged();
+        *now = CYCLES();
+    } while (s != sumCharged());
+    return s;
+}
+
+static void openWindow(void)
+{
+    uint8_t i;
+    windowStart = CYCLES();
+    windowSamples = samples;
+    for (i = 0; i < LOAD_SOURCES; i++)
+        windowCharged[i] = charged[i];
+}
+
+// Starts the first interval, the cycle counter must be running
+void initLoad(uint32_t intervalCycles)
+{
+    interval = intervalCycles;
+    last.cycles = 0;
+    openWindow();
+}
+
+void setLoadInterval(uint32_t intervalCycles)
+{
+    interval = intervalCycles;
+    openWindow();
+}
+
+uint32_t getLoadInterval(void)
+{
+    return interval;
+}
+
+RAMFUNC void beginLoad(LOAD_MARK* m)
+{
+    m->nested = snapshot(&m->start);
+}
+
+// Cycles since beginLoad less what nested handlers charged meanwhile
+RAMFUNC uint32_t getLoadExclusive(const LOAD_MARK* m)
+{
+    uint32_t now, nested = snapshot(&now) - m->nested;
+    return (now - m->start) - nested;
+}
+
+// Charges s with the exclusive cycles of the mark
+RAMFUNC void endLoad(const LOAD_MARK* m, LOAD_SOURCE s)
+{
+    charged[s] += getLoadExclusive(m);
+}
+
+// Sample ISR, one per DAC pair
+RAMFUNC void countLoadSample(void)
+{
+    samples++;
+}
+
+// Main loop: closes the interval once it has run its length, returns true
+// when a new report is ready
+bool updateLoad(void)
+{
+    uint32_t elapsed = CYCLES() - windowStart;
+    uint8_t i;
+    if (elapsed < interval)
+        return false;
+    last.cycles = elapsed;
+    last.samples = samples - windowSamples;
+    for (i = 0; i < LOAD_SOURCES; i++)
+        last.source[i] = charged[i] - windowCharged[i];
+    openWindow();
+    total = 10000 - getLoadPercent(&last, LOAD_IDLE);
+    if (total > peak)
+        peak = total;
+    return true;
+}
+
+// Last closed interval, cycles = 0 before the first one
+const LOAD_REPORT* getLoad(void)
+{
+    return &last;
+}
+
+// Share of the interval spent in s, % x 100
+uint16_t getLoadPercent(const LOAD_REPORT* r, LOAD_SOURCE s)
+{
+    if (r->cycles == 0)
+        return 0;
+    return (uint64_t) r->source[s] * 10000 / r->cycles;
+}
+
+// Everything but idle, % x 100; time outside any mark counts as load
+uint16_t getLoadTotal(void)
+{
+    return total;
+}
+
+uint16_t getLoadPeak(void)
+{
+    return peak;
+}
+
+void resetLoadPeak(void)
+{
+    peak = 0;
+}
@@ -23,10 +23,31 @@
 #include <ctype.h>
 #include <math.h>
 #include <tm4c123gh6pm.h>
+#include "inc/awg.h"
+#include "inc/chirp.h"
 #include "inc/clock.h"
+#include "inc/config.h"
+#include "inc/cycle.h"
+#include "inc/defer.h"
+#include "inc/eeprom.h"
+#include "inc/fec.h"
+#include "inc/flashwave.h"
+#include "inc/fsk.h"
 #include "inc/gpio.h"
+#include "inc/hop.h"
+#include "inc/iqcal.h"
+#include "inc/load.h"
+#include "inc/modulator.h"
+#include "inc/multitone.h"
+#include "inc/nco.h"
 #include "inc/nvic.h"
+#include "inc/ofdm.h"
+#include "inc/output.h"
+#include "inc/packet.h"
+#include "inc/prbs.h"
+#include "inc/ramexec.h"
 #include "inc/spi0.h"
+#include "inc/stream.h"
 #include "inc/uart0.h"
 #include "inc/wait.h"
 
@@ -34,7 +55,17 @@
 #define MAX_CHARS 80    // Maximum String Characters
 #define FCYC 40e6       // FC Cycles for SPI
 #define FDAC 20e6       // F Cycles for DAC
-#define FS 100000       // FS Sample Rate
+#define FS 20000        // FS Default Sample Rate
+#define UPLOAD_TIMEOUT 100  // ms a binary upload waits for each byte
+
+// Interrupt priorities (0 highest): the sample output may only be delayed
+// by its own previous instance, DMA refills would come next, the UART
+// receive keeps the shell from dropping bytes, and PendSV runs the block
+// generation below every handler
+#define PRIORITY_SAMPLE 0       // TIMER1A, DAC pair out
+#define PRIORITY_DMA    1       // reserved, no uDMA channels in use yet
+#define PRIORITY_UART   2       // UART0 receive into the shell ring
+#define PRIORITY_DEFER  7       // PendSV, deferred work
 
 
 // > Hardware Defined Pins DAC Control
@@ -43,6 +74,9 @@
 #define SDI     PORTA,  5       // PA5
 #define LDAC    PORTA,  4       // PA4 [ACT LOW]
 
+// > Sweep trigger marker, high at the start of every sweep
+#define MARKER  PORTA,  6       // PA6
+
 // > DAC RAW Write Directives
 //  Writing to Channel I (A) First 4 bits is [A/B X GA SHUT]
 //  ([0011]000000000000)2 = (12288)10
@@ -55,117 +89,188 @@
 #define D_VREF 2.048            // DAC Voltage Reference
 #define TWO_32 4294967296
 
-int WRITE_Q = CHAN_Q_START; // Channel A = I OUTPUT
-int WRITE_I = CHAN_I_START; // Channel B = Q OUTPUT
+int WRITE_Q = CHAN_Q_START + DAC_MID; // Channel A = I OUTPUT, analog zero at boot
+int WRITE_I = CHAN_I_START + DAC_MID; // Channel B = Q OUTPUT
+uint32_t DacPair = CHAN_Q_START | ((uint32_t) CHAN_I_START << 16); // last pair the ISR wrote
 
-// ================================ Lookup Tables Guides ===============================
-// Defining the Lookup tables for the Instance
-uint16_t LUT_I[4096];
-uint16_t LUT_Q[4096];
+// ================================ Phase Accumulator Guides ==========================
+// Current sample rate (set by sr)
+float sampleRate = FS;
 
 // For Channel I
-int IntCn_I = 0; int Inc_B_I = 1;
-uint32_t phi_I = 0; int fO_I = 10000;
+uint32_t phase_I = 0; uint32_t phi_I = 0; int fO_I = 0;
 
 // For Channel Q
-int IntCn_Q = 0; int Inc_B_Q = 1;
-uint32_t phi_Q = 0; int fO_Q = 10000;
+uint32_t phase_Q = 0; uint32_t phi_Q = 0; int fO_Q = 0;
 
 
 // ============================== Modulation Guides ===================================
 // Enumeration data structure for Modulation for modulation guide
-enum mode { raw, dc, sine, bpsk, qpsk, psk8, qam16 };
+//  > symbols: any constellation of the modulator library (mod command)
+//  > fsk:     continuous phase FSK family (fsk command)
+//  > awg:     uploaded waveform playback (awg command)
+//  > wave:    compressed flash waveform streaming (wave command)
+//  > ofdm:    OFDM symbols of the mod scheme (ofdm command)
+//  > sweep:   linear/log frequency sweep (sweep command)
+//  > multi:   sum of up to 16 tones (multi command)
+//  > packet:  bursts of the mod scheme with idle gaps (packet command)
+enum mode { raw, dc, sine, symbols, fsk, awg, wave, ofdm, sweep, multi, packet };
 enum mode mode;
-// Modulation Symbol Guide as follows:
-uint32_t symbolsPerMod[7] = {1, 1, 1, 1, 2, 3, 4};
-uint32_t loopValPerMod[7] = {1, 1, 4096, 2, 4, 8, 16};
-uint32_t loopVal = 1;
-int loopval = 1;
+const char *ModeNames[] = { "raw", "dc", "sine", "mod", "fsk", "awg", "wave", "ofdm",
+                            "sweep", "multi", "packet" };
 
 // Channel Q Gain
 #define Q_GAIN ((4095 - 175) / 2)
 // Channel I Gain
 #define I_GAIN ((4095 - 190) / 2)
 
-int32_t I_Bits = 0;
-int32_t Q_Bits = 0;
+// ===================================================================================
+// Tone Modulation Command Vars
+bool ToneMode = false;
 
-int32_t OOK_I[2] = {0 , I_GAIN};
-int32_t OOK_Q[2] = {0, 0};
+// ===================================================================================
+// Filter Variables
+bool RRCFilter = false;
 
-int32_t BPSK_I[2] = {I_GAIN, -I_GAIN};
-int32_t BPSK_Q[2] = {0, 0};
+// ===================================================================================
+// FSK Command Vars
+FSK_TYPE FskType = MSK;
+float FskParam = 0.5;
 
-int32_t QPSK_I[2] = {I_GAIN, -I_GAIN};
-int32_t QPSK_Q[2] = {Q_GAIN, -Q_GAIN};
+// ===================================================================================
+// Frequency Hopping (applies to the symbols and fsk modes)
+bool Hopping = false;
 
-int32_t PSK8_I[8] = {I_GAIN*1.00, I_GAIN*0.71, -I_GAIN*0.71, I_GAIN*0.00,
-                     I_GAIN*0.71, -I_GAIN*0.00, -I_GAIN*1.00, -I_GAIN*0.71};
-int32_t PSK8_Q[8] = {Q_GAIN*0.00, Q_GAIN*0.71, Q_GAIN*0.71, Q_GAIN*1.00,
-                     -Q_GAIN*0.71, -Q_GAIN*1.00, -Q_GAIN*0.00, -Q_GAIN*0.71};
+// ===================================================================================
+// Block streaming: streamed modes are generated ahead into the sample ring by
+// PendSV work the ISR defers whenever a block is free, and the ISR only
+// drains it. raw/dc (live codes) and sweep (sample exact marker) stay on the
+// per-sample ISR path, as does every mode with streaming off.
+bool Streaming = true;
+volatile enum mode StreamMode = raw;    // mode the ring holds samples of, raw = none
+int8_t StreamWork;                      // deferred work id of ServiceStream
 
-int32_t QUAM16_I[4] = {-I_GAIN*1.00, -I_GAIN*0.33, I_GAIN*1.00, I_GAIN*0.33};
-int32_t QUAM16_Q[4] = {-Q_GAIN*1.00, -Q_GAIN*0.33, Q_GAIN*1.00, Q_GAIN*0.33};
+// ===================================================================================
+// Sample interrupt latency, cycles from the timer timeout to the ISR's first
+// instruction, worst case since the last reset
+volatile uint32_t LatencyWorst = 0;
 
-int32_t QUAM64_I[8] = {-I_GAIN*1.00, -I_GAIN*0.71, -I_GAIN*0.14, -I_GAIN*0.43,
-                      I_GAIN*1.00, I_GAIN*0.71, I_GAIN*0.14, I_GAIN*0.43};
-int32_t QUAM64_Q[8] = {-Q_GAIN*1.00, -Q_GAIN*0.71, -Q_GAIN*0.14, -Q_GAIN*0.43,
-                      Q_GAIN*1.00, Q_GAIN*0.71, Q_GAIN*0.14, Q_GAIN*0.43};
 // ===================================================================================
-// Tone Modulation Command Vars
-bool ToneMode = false;
+// CPU load meter: intervals of LoadInterval, printed as they close while
+// watching; the report is for LoadReportMode, valid if the mode held
+#define LOAD_INTERVAL 1000      // Default interval ms
+bool LoadWatch = false;
+enum mode LoadWindowMode = raw;
+enum mode LoadReportMode = raw;
+bool LoadReportValid = false;
 
 // ===================================================================================
-// Filter Variables
-bool RRCFilter = false;
+// Boot timing on the cycle counter started in ResetISR: it runs at the 16 MHz
+// PIOSC until the PLL takes over, at FCYC after
+#define PIOSC 16e6
+uint32_t BootClockCycles;               // counter when the PLL was selected
+uint32_t BootMainCycles;                // counter at main(), after C init
+volatile uint32_t BootSampleCycles = 0; // counter at the first valid DAC pair
+bool BootLogged = false;
 
-// Filter Coefficients [rrc, order=30, fs/fc = 8, alpha=0.25]
-float h[31] = {0.0023, -0.0043, -0.0102, -0.0090, 0.0015, 0.0159, 0.0230, 0.0130,
-                -0.0136, -0.0422, -0.0493, -0.0160, 0.0593, 0.1553, 0.2357, 0.2671,
-                 0.2357,  0.1553,  0.0593, -0.0160, -0.0493, -0.0422, -0.0136, 0.0130,
-                 0.0230,  0.0159,  0.0015, -0.0090, -0.0102, -0.0043, 0.0023};
-// Zero Padded Modulation arrays
-// > BPSK
-float BPSK_I_Filter[8] = {I_GAIN, 0, 0, 0, -I_GAIN, 0, 0, 0};
-float BPSK_Q_Filter[8] = {0, 0, 0, 0, 0, 0, 0, 0};
-// > QPSK
-float QPSK_I_Filter[8] = {I_GAIN, 0, 0, 0, -I_GAIN, 0, 0, 0};
-float QPSK_Q_Filter[8] = {Q_GAIN, 0, 0, 0, -Q_GAIN, 0, 0, 0};
-// > 8PSK
-float PSK8_I_Filter[33] = {I_GAIN*1.00, 0, 0, 0, I_GAIN*0.71, 0, 0, 0, -I_GAIN*0.71, 0, 0, 0, I_GAIN*0.00, 0, 0, 0,
-                            I_GAIN*0.71, 0, 0, 0, -I_GAIN*0.00, 0, 0, 0, -I_GAIN*1.00, 0, 0, 0, -I_GAIN*0.71, 0, 0, 0,};
-float PSK8_Q_Filter[33] = {Q_GAIN*0.00, 0, 0, 0, Q_GAIN*0.71, 0, 0, 0, Q_GAIN*0.71, 0, 0, 0, Q_GAIN*1.00, 0, 0, 0,
-                            -Q_GAIN*0.71, 0, 0, 0, -Q_GAIN*1.00, 0, 0, 0, -Q_GAIN*0.00, 0, 0, 0, -Q_GAIN*0.71, 0, 0, 0,};
-// > 16QAM
-float QUAM16_I_Filter[16] = {-I_GAIN*1.00, 0, 0, 0, -I_GAIN*0.33, 0, 0, 0, I_GAIN*1.00, 0, 0, 0, I_GAIN*0.33, 0, 0, 0,};
-float QUAM16_Q_Filter[16] = {-Q_GAIN*1.00, 0, 0, 0, -Q_GAIN*0.33, 0, 0, 0, Q_GAIN*1.00, 0, 0, 0, Q_GAIN*0.33, 0, 0, 0,};
+// ===================================================================================
+// Sample path timing (exec command), samples per run
+#define EXEC_BENCH 1024
 
 // ===================================================================================
 // Declaring the Instances of functions declared in this scope
 void initHw();
 void processShell();
 void initSymbolTimer(void);
+void startSymbolTimer(void);
+uint32_t BootMicros(uint32_t cycles);
+void PrintBootLog(void);
 void setSymbolRate(float sampleRate);
 void symbolTimerIsr();
 void RAWModulator(char *OPTION, int N);
 void DCModulator(char *OPTION, float DC);
-void SineModulator(char *OPTION, int f, float AMP);
-void ToneModulator(int f, float AMP);
+void SineModulator(char *OPTION, int f, float AMP, float PHASE, float DC);
+void ToneModulator(int f, float AMP, float PHASE, float DC);
+void LevelModulator(char *OPTION, float AMP, float PHASE, float DC);
+void CalibrationShell(char *OPTION);
+void getConfig(CONFIG *cfg);
+void applyConfig(const CONFIG *cfg);
+float nextArg(float def);
 void Modulator(char *OPTION, char *data);
+void FskModulator(char *OPTION, float PARAM, char *data);
+void UpdateFsk(void);
+void AwgModulator(char *OPTION);
+bool UploadByte(uint8_t *b);
+void WaveModulator(char *OPTION);
+void OfdmModulator(char *OPTION);
+void SweepModulator(float F0, float F1, float TIME, char *LAW, char *RUN);
+void MultitoneModulator(char *OPTION);
+void HopShell(char *OPTION);
+void PrbsShell(char *OPTION);
+void FecShell(char *OPTION, bool scrambler);
+void PacketModulator(char *OPTION, char *data);
 void Filtermode();
+uint32_t nextSample(void);
+uint32_t modeSample(enum mode m);
+bool streamedMode(enum mode m);
+void ServiceStream(void);
+enum mode StopMode(void);
+void StartMode(enum mode m);
+void StreamShell(char *OPTION);
+void LatencyShell(char *OPTION);
+void CloseLoadInterval(void);
+void PrintLoad(void);
+void LoadShell(char *OPTION);
+void CapacityShell(void);
+void ExecShell(void);
 
 // Code Main Routine
 int main(void) {
+    CONFIG cfg;
+    bool restored;
+    BootMainCycles = CYCLES();
+
     initHw();   // Running Hardware Setup instance
 
+    // Boot straight into the last saved operating mode (analog zero on raw
+    // otherwise), prime the ring and only then start the samples, so the
+    // first pair out is already the mode's
+    restored = loadConfig(&cfg);
+    if (restored)
+        applyConfig(&cfg);
+    ServiceStream();
+    startSymbolTimer();
+
     // Display Header
     putsUart0("===============================================\n\r");
     putsUart0("         CSE 4377 > Modulator Console\n\r");
     putsUart0("===============================================\n\r");
+    if (restored)
+        putsUart0("[+] Restored saved configuration\n\r");
 
     // Main instance of the Program
     while (true) {
-        processShell(); // Shell UI Instance
+        LOAD_MARK mark;
+        LOAD_SOURCE pass = LOAD_IDLE;
+        beginLoad(&mark);
+        if (kbhitUart0()) {
+            pass = LOAD_SHELL;
+            LoadWatch = false;  // Any key ends load watch
+        }
+        processShell();     // Shell UI Instance
+        if (!streamedMode(mode)) {
+            if (serviceFlashWave()) // Decode ahead of the flash waveform player
+                pass = LOAD_SERVICE;
+            if (mode == ofdm && serviceOfdm())
+                pass = LOAD_SERVICE;    // Next OFDM symbol, shares the mapper with mod
+        }                   // (streamed modes do both in PendSV)
+        endLoad(&mark, pass);
+        if (updateLoad())
+            CloseLoadInterval();
+        if (BootSampleCycles && !BootLogged) {
+            PrintBootLog();
+            BootLogged = true;
+        }
     }
 }
 
@@ -173,6 +278,7 @@ int main(void) {
 // Initialize Hardware Setup Routine
 void initHw() {
     // Initialize system clock to 40 MHz
+    BootClockCycles = CYCLES();
     initSystemClockTo40Mhz();
 
     // Setup UART0 baud rate
@@ -192,9 +298,29 @@ void initHw() {
     setPinValue(CS, true);
     setPinValue(LDAC, true);
 
-    // Initialize symbol timer
-    initSymbolTimer();
+    // Sweep marker output, idle low
+    selectPinPushPullOutput(MARKER);
+    setPinValue(MARKER, false);
+
+    // Load meter on the cycle counter (running since ResetISR)
+    initLoad(LOAD_INTERVAL * (uint32_t) (FCYC / 1000));
+
+    // Default constellation and unity output stage, then the board's IQ
+    // calibration (sine and FEC tables are const, nothing to build)
+    setScheme(BPSK, I_GAIN, Q_GAIN);
+    initOutputStage();
+    if (initEeprom())
+        loadIqCorrection();
 
+    // Priority map, shell input on interrupts and the ring refill in PendSV
+    initDeferredWork(PRIORITY_DEFER);
+    StreamWork = addDeferredWork(ServiceStream);
+    enableUart0RxInterrupt();
+    setNvicInterruptPriority(INT_UART0, PRIORITY_UART);
+    enableNvicInterrupt(INT_UART0);
+
+    // Initialize symbol timer, started once the boot mode is set
+    initSymbolTimer();
 }
 
 // Sub-routine for creating a shell instance on UART
@@ -243,48 +369,230 @@ void processShell() {
             // sine a|b FREQ [AMPL [PHASE [DC] ] ]
             if (strcmp(token, "sine") == 0) {
                 knownCommand = true;
-                mode = sine;
-                char *OPTION; int f; float AMP;
+                char *OPTION; int f; float AMP; float PHASE; float DC;
                 OPTION = strtok(NULL, " ");
-                f = atoi(strtok(NULL, " "));
-                AMP = atof(strtok(NULL, " "));
-                if (strcmp(OPTION, "i") == 0 || strcmp(OPTION, "q") == 0){
-                    SineModulator(OPTION, f, AMP);
+                f = nextArg(0);
+                AMP = nextArg(0.5);
+                PHASE = nextArg(0);
+                DC = nextArg(0);
+                StopMode();
+                if (OPTION && (strcmp(OPTION, "i") == 0 || strcmp(OPTION, "q") == 0)){
+                    SineModulator(OPTION, f, AMP, PHASE, DC);
                 }
+                StartMode(sine);
             }
 
             // tone FREQ [AMPL [PHASE [DC] ] ]
             if (strcmp(token, "tone") == 0) {
-                knownCommand = true; int f; float AMP;
-                mode = sine;
-                f = atoi(strtok(NULL, " "));
-                AMP = atof(strtok(NULL, " "));
-                ToneModulator(f, AMP);
+                knownCommand = true; int f; float AMP; float PHASE; float DC;
+                f = nextArg(0);
+                AMP = nextArg(0.5);
+                PHASE = nextArg(0);
+                DC = nextArg(0);
+                StopMode();
+                ToneModulator(f, AMP, PHASE, DC);
+                StartMode(sine);
+            }
+
+            // level i|q AMPL [PHASE [DC] ]
+            if (strcmp(token, "level") == 0) {
+                knownCommand = true;
+                char *OPTION; float AMP; float PHASE; float DC;
+                OPTION = strtok(NULL, " ");
+                AMP = nextArg(0.5);
+                PHASE = nextArg(0);
+                DC = nextArg(0);
+                if (OPTION && (strcmp(OPTION, "i") == 0 || strcmp(OPTION, "q") == 0)){
+                    LevelModulator(OPTION, AMP, PHASE, DC);
+                }
             }
 
-            // mod bpsk|qpsk|8psk|16qam
+            // mod SCHEME [DATA]
             if (strcmp(token, "mod") == 0) {
                 knownCommand = true;
                 char *OPTION; char *String;
                 OPTION = strtok(NULL, " ");
-                String = strtok(NULL, " ");
-                Modulator(OPTION, String);
+                String = strtok(NULL, "");
+                if (OPTION)
+                    Modulator(OPTION, String);
+            }
+
+            // fsk cpfsk H|msk|gmsk BT [DATA]
+            if (strcmp(token, "fsk") == 0) {
+                knownCommand = true;
+                char *OPTION; float PARAM = 0.5;
+                OPTION = strtok(NULL, " ");
+                if (OPTION && (strcmp(OPTION, "cpfsk") == 0 || strcmp(OPTION, "gmsk") == 0))
+                    PARAM = nextArg(strcmp(OPTION, "gmsk") == 0 ? 0.3 : 1.0);
+                if (OPTION)
+                    FskModulator(OPTION, PARAM, strtok(NULL, ""));
+            }
+
+            // awg load N | play [STEP [lin] ]
+            if (strcmp(token, "awg") == 0) {
+                knownCommand = true;
+                char *OPTION = strtok(NULL, " ");
+                if (OPTION)
+                    AwgModulator(OPTION);
+            }
+
+            // wave NAME|list|bench
+            if (strcmp(token, "wave") == 0) {
+                knownCommand = true;
+                char *OPTION = strtok(NULL, " ");
+                if (OPTION)
+                    WaveModulator(OPTION);
+            }
+
+            // ofdm 64|128|256 [CP]|bench
+            if (strcmp(token, "ofdm") == 0) {
+                knownCommand = true;
+                char *OPTION = strtok(NULL, " ");
+                if (OPTION)
+                    OfdmModulator(OPTION);
+            }
+
+            // sweep F0 F1 TIME [lin|log [once|repeat|updown] ]
+            if (strcmp(token, "sweep") == 0) {
+                knownCommand = true;
+                float F0, F1, TIME; char *LAW;
+                F0 = nextArg(0);
+                F1 = nextArg(0);
+                TIME = nextArg(0);
+                LAW = strtok(NULL, " ");
+                SweepModulator(F0, F1, TIME, LAW, strtok(NULL, " "));
+            }
+
+            // multi add FREQ [AMPL [PHASE] ]|clear|bench
+            if (strcmp(token, "multi") == 0) {
+                knownCommand = true;
+                char *OPTION = strtok(NULL, " ");
+                if (OPTION)
+                    MultitoneModulator(OPTION);
+            }
+
+            // packet [DATA]|format PREAMBLE [SYNC [CRC] ]|timing GAP [RAMP]
+            if (strcmp(token, "packet") == 0) {
+                knownCommand = true;
+                char *OPTION = strtok(NULL, " ");
+                if (OPTION && (strcmp(OPTION, "format") == 0 || strcmp(OPTION, "timing") == 0))
+                    PacketModulator(OPTION, NULL);
+                else
+                    PacketModulator(OPTION, OPTION ? strtok(NULL, "") : NULL);
+            }
+
+            // prbs 7|9|15|23|31 [SEED [RATE] ]|off
+            if (strcmp(token, "prbs") == 0) {
+                knownCommand = true;
+                char *OPTION = strtok(NULL, " ");
+                if (OPTION)
+                    PrbsShell(OPTION);
+            }
+
+            // fec 1/2|2/3|3/4|off|bench, scramble add|mult|off
+            if (strcmp(token, "fec") == 0 || strcmp(token, "scramble") == 0) {
+                knownCommand = true;
+                char *OPTION = strtok(NULL, " ");
+                if (OPTION)
+                    FecShell(OPTION, strcmp(token, "scramble") == 0);
+            }
+
+            // hop table F1 [F2 ..]|prng N SPACING [SEED]|dwell SAMPLES [GUARD]|off
+            if (strcmp(token, "hop") == 0) {
+                knownCommand = true;
+                char *OPTION = strtok(NULL, " ");
+                if (OPTION)
+                    HopShell(OPTION);
             }
 
-            // filter FILTER
+            // filter rrc|off|bench
             if (strcmp(token, "filter") == 0) {
                 knownCommand = true;
-                char *OPTION;
+                char *OPTION; enum mode running;
                 OPTION = strtok(NULL, " ");
-                if (strcmp(OPTION, "rrc") == 0){
+                if (OPTION && strcmp(OPTION, "rrc") == 0){
+                    running = StopMode();
                     RRCFilter = true;
-                } else if (strcmp(OPTION, "off") == 0){
+                    setShaping(true);
+                    UpdateFsk();
+                    StartMode(running);
+                } else if (OPTION && strcmp(OPTION, "off") == 0){
+                    running = StopMode();
                     RRCFilter = false;
+                    setShaping(false);
+                    StartMode(running);
+                } else if (OPTION && strcmp(OPTION, "bench") == 0){
+                    char str[60];
+                    uint32_t c = benchShaper();
+                    sprintf(str, "FIR: %"PRIu32".%02"PRIu32" cycles/tap, %u taps/sample (I+Q)\n\r",
+                            c / 100, c % 100, 2 * RRC_SYMBOLS);
+                    putsUart0(str);
                 } else {
                     putsUart0("[!] Invalid Filter Setting. Try help.\n\r");
                 }
             }
 
+            // stream [on|off]
+            if (strcmp(token, "stream") == 0) {
+                knownCommand = true;
+                StreamShell(strtok(NULL, " "));
+            }
+
+            // load [watch|reset|MS]
+            if (strcmp(token, "load") == 0) {
+                knownCommand = true;
+                LoadShell(strtok(NULL, " "));
+            }
+
+            // capacity
+            if (strcmp(token, "capacity") == 0) {
+                knownCommand = true;
+                CapacityShell();
+            }
+
+            // exec
+            if (strcmp(token, "exec") == 0) {
+                knownCommand = true;
+                ExecShell();
+            }
+
+            // latency [reset]
+            if (strcmp(token, "latency") == 0) {
+                knownCommand = true;
+                LatencyShell(strtok(NULL, " "));
+            }
+
+            // sps SAMPLES_PER_SYMBOL
+            if (strcmp(token, "sps") == 0) {
+                knownCommand = true;
+                enum mode running = StopMode();
+                if (!setSamplesPerSymbol(nextArg(0)))
+                    putsUart0("[!] Invalid SPS (1-16, 4 with rrc).\n\r");
+                UpdateFsk();
+                StartMode(running);
+            }
+
+            // cal [a b c d [OI [OQ] ] | iq GAIN SKEW [OI [OQ] ] | save | reset | bench]
+            if (strcmp(token, "cal") == 0) {
+                knownCommand = true;
+                CalibrationShell(strtok(NULL, " "));
+            }
+
+            // config save|clear
+            if (strcmp(token, "config") == 0) {
+                knownCommand = true;
+                char *OPTION = strtok(NULL, " ");
+                CONFIG cfg;
+                if (OPTION && strcmp(OPTION, "save") == 0) {
+                    getConfig(&cfg);
+                    saveConfig(&cfg);
+                } else if (OPTION && strcmp(OPTION, "clear") == 0) {
+                    clearConfig();
+                } else {
+                    putsUart0("[!] Invalid Config Setting. Try help.\n\r");
+                }
+            }
+
             if (strcmp(token,"sr")==0) {
                 knownCommand = true;
                 float SRate = atof(strtok(NULL, " "));
@@ -307,16 +615,57 @@ void processShell() {
                 putsUart0("  dc       i|q DC\n\r");
                 putsUart0("  sine     i|q FREQ [AMPL [PHASE [DC] ] ]\n\r");
                 putsUart0("  tone     FREQ [AMPL [PHASE [DC] ] ]\n\r");
-                putsUart0("  mod      ook|bpsk|qpsk|8psk|16qam|64qam\n\r");
-                putsUart0("  filter   rrc|off\n\r");
+                putsUart0("  level    i|q AMPL [PHASE [DC] ]\n\r");
+                putsUart0("  mod      ook|bpsk|qpsk|8psk|16qam|64qam|\n\r");
+                putsUart0("           256qam|16apsk|32apsk|oqpsk|pi4dqpsk|\n\r");
+                putsUart0("           dbpsk|dqpsk|d8psk [DATA]\n\r");
+                putsUart0("  fsk      cpfsk H|msk|gmsk BT [DATA]\n\r");
+                putsUart0("  awg      load N|play [STEP [lin] ]\n\r");
+                putsUart0("  wave     NAME|list|bench\n\r");
+                putsUart0("  ofdm     64|128|256 [CP]|bench\n\r");
+                putsUart0("  sweep    F0 F1 TIME [lin|log [once|repeat|updown] ]\n\r");
+                putsUart0("  multi    add FREQ [AMPL [PHASE] ]|clear|bench\n\r");
+                putsUart0("  packet   [DATA]|format PREAMBLE [SYNC [CRC] ]\n\r");
+                putsUart0("  packet   timing GAP [RAMP]\n\r");
+                putsUart0("  prbs     7|9|15|23|31 [SEED [RATE] ]|off\n\r");
+                putsUart0("  fec      1/2|2/3|3/4|off|bench\n\r");
+                putsUart0("  scramble add|mult|off\n\r");
+                putsUart0("  hop      table F1 [F2 ..]|prng N SPACING [SEED]\n\r");
+                putsUart0("  hop      dwell SAMPLES [GUARD]|off\n\r");
+                putsUart0("  filter   rrc|off|bench\n\r");
+                putsUart0("  sps      SAMPLES_PER_SYMBOL\n\r");
+                putsUart0("  stream   [on|off]\n\r");
+                putsUart0("  latency  [reset]\n\r");
+                putsUart0("  load     [watch|reset|MS]\n\r");
+                putsUart0("  capacity\n\r");
+                putsUart0("  exec\n\r");
                 putsUart0("  raw      i|q RAW\n\r");
                 putsUart0("  sr       SYMBOLRATE\n\r");
+                putsUart0("  config   save|clear\n\r");
+                putsUart0("  cal      [A B C D [OI [OQ] ] ]\n\r");
+                putsUart0("  cal      iq GAIN SKEW [OI [OQ] ]\n\r");
+                putsUart0("  cal      save|reset|bench\n\r");
                 putsUart0("  reboot\n\r");
                 putsUart0("\n\r");
                 putsUart0("  where FREQ = [-Fs/2, Fs/2] Hz\n\r");
                 putsUart0("        AMPL = [0, 0.5] V\n\r");
+                putsUart0("        PHASE = [0, 360] deg, sine and tone only\n\r");
                 putsUart0("        DC   = [-0.5, 0.5] V\n\r");
                 putsUart0("        RAW  = [0, 4095] LSb\n\r");
+                putsUart0("        N    = [1, 2048] I/Q pairs, int16 LE I then Q,\n\r");
+                putsUart0("               dropped after a 100 ms gap between bytes\n\r");
+                putsUart0("        STEP = waveform samples per output sample\n\r");
+                putsUart0("        CP   = [0, N/4] samples, default N/4\n\r");
+                putsUart0("        F0/F1 = (-Fs/2, Fs/2) Hz, > 0 for log, TIME s\n\r");
+                putsUart0("        multi AMPL = (0, 1] relative, no PHASE = Newman\n\r");
+                putsUart0("        PREAMBLE = 0xAA bytes, SYNC = 32 bit, CRC = 0|1\n\r");
+                putsUart0("        GAP/RAMP = idle and ramp symbols per burst\n\r");
+                putsUart0("        SEED = PRBS register (0x.. ok), RATE = injected BER\n\r");
+                putsUart0("        F1.. = hop offsets Hz, GUARD = blanked samples per hop\n\r");
+                putsUart0("        H    = FSK modulation index, BT = [0.2, 1]\n\r");
+                putsUart0("        A..D = [-1, 1) Q15, GAIN dB, SKEW deg\n\r");
+                putsUart0("        OI/OQ = DAC offset LSb\n\r");
+                putsUart0("        MS   = [10, 10000] load interval, watch ends on a key\n\r");
             }
         putsUart0("\n\r");
         }
@@ -333,64 +682,340 @@ void initSymbolTimer(void) {
     TIMER1_CTL_R &= ~TIMER_CTL_TAEN;                 // turn-off timer before reconfiguring
     TIMER1_CFG_R = TIMER_CFG_32_BIT_TIMER;           // configure as 32-bit timer (A+B)
     TIMER1_TAMR_R = TIMER_TAMR_TAMR_PERIOD;          // configure for periodic mode (count down)
-    //TIMER1_TAILR_R = round(FCYC/FS);                 // set load value to match sample rate
-    TIMER1_TAILR_R = 2000;
+    TIMER1_TAILR_R = round(FCYC/FS);                 // set load value to match sample rate
     TIMER1_IMR_R = TIMER_IMR_TATOIM;                 // turn-on interrupts for timeout in timer module
-    TIMER1_CTL_R |= TIMER_CTL_TAEN;                  // turn-on timer
+    setNvicInterruptPriority(INT_TIMER1A, PRIORITY_SAMPLE);
     enableNvicInterrupt(INT_TIMER1A);                // turn-on interrupt 37 (TIMER1A) in NVIC
+}
 
+void startSymbolTimer(void) {
+    TIMER1_CTL_R |= TIMER_CTL_TAEN;                  // turn-on timer
 }
 
-void setSymbolRate(float sampleRate) {
+void setSymbolRate(float SRate) {
+    bool hopping;
+    if (SRate <= 0)
+        return;
+    sampleRate = SRate;
     TIMER1_TAILR_R = round(FCYC/sampleRate);
+
+    // The latency is measured against TAILR, a worst case of the old
+    // period says nothing about the new one
+    LatencyWorst = 0;
+
+    // Keep tone frequencies in Hz across rate changes
+    phi_I = ncoFrequencyWord(fO_I, sampleRate);
+    phi_Q = ncoFrequencyWord(fO_Q, sampleRate);
+    if (mode == multi) {
+        StopMode();
+        setMultitone(sampleRate, I_GAIN, Q_GAIN);
+        StartMode(multi);
+    }
+    hopping = Hopping;
+    Hopping = false;
+    setHopRate(sampleRate);
+    Hopping = hopping;
 }
 
 // Interrupt service routine for triggering write to I/Q channels of the DAC
-void symbolTimerIsr() {
+RAMFUNC void symbolTimerIsr() {
+    uint32_t latency = TIMER1_TAILR_R - TIMER1_TAV_R;
+    LOAD_MARK mark;
+
+    // Worst entry delay, the timer has counted down since its timeout
+    if (latency > LatencyWorst)
+        LatencyWorst = latency;
+    beginLoad(&mark);
+
     // Trigger LDAC
     setPinValue(LDAC, false);
     _delay_cycles(10);
     setPinValue(LDAC, true);
 
-    // Enums used used to Modulate in ISR
-    if (mode == sine) {
-        // Sine
-        RAWModulator("i", LUT_I[IntCn_I]);
-        RAWModulator("q", LUT_Q[IntCn_Q]);
-    } else if (mode == bpsk) {
-        //Bpsk
-        RAWModulator("i", (-BPSK_I[IntCn_I] + 2135));
-        RAWModulator("q", (-BPSK_Q[IntCn_Q] + 2135));
-    } else if(mode==qpsk) {
-        //qpsk (upper bit vs lower bit)
-        I_Bits = IntCn_I & 1;                 // and with 01 to only get value of first bit
-        Q_Bits = IntCn_Q & 2;                 // and with 10 to only get value of second bit
-        Q_Bits = Q_Bits >> 1;
-        RAWModulator("i", (-QPSK_I[I_Bits] + 2135));
-        RAWModulator("q", (-QPSK_Q[Q_Bits] + 2135));
-    } else if(mode == psk8) {
-        //8psk
-        RAWModulator("i", (-PSK8_I[IntCn_I] + 2135));
-        RAWModulator("q", (-PSK8_Q[IntCn_Q] + 2135));
-    } else if(mode == qam16) {
-        //16qam (upper 2 bits vs lower 2 bits)
-        I_Bits = IntCn_I & 3;               //and with 0011 to get only the lower 2 bits
-        Q_Bits = IntCn_Q & 12;              //and with 1100 to get only the upper 2 bits
-        Q_Bits = Q_Bits >> 2;
-        RAWModulator("i", (-QUAM16_I[I_Bits] + 2135));
-        RAWModulator("q", (-QUAM16_Q[Q_Bits] + 2135));
+    if (streamedMode(mode)) {
+        // Ring primed for this mode: copy the next pair, hold the last one on
+        // underrun; after a mode change hold until PendSV has primed it
+        if (mode == StreamMode && readStream(&DacPair) && BootSampleCycles == 0)
+            BootSampleCycles = CYCLES();
+        if (mode != StreamMode || getStreamFree() >= STREAM_BLOCK)
+            deferWork(StreamWork);
+    } else {
+        // Per-sample path, the ring is stale from here on
+        StreamMode = raw;
+        DacPair = nextSample();
+        if (BootSampleCycles == 0)
+            BootSampleCycles = CYCLES();
     }
 
     // Write on SPI Port
-    SSI0_DR_R = WRITE_Q;
-    SSI0_DR_R = WRITE_I;
-
-    // Interrupt revolving counter for ISR Read and increment modes
-    IntCn_I = (IntCn_I + Inc_B_I) % loopValPerMod[mode];   // Channel I
-    IntCn_Q = (IntCn_Q + Inc_B_Q) % loopValPerMod[mode];   // Channel Q
+    SSI0_DR_R = DacPair & 0xFFFF;
+    SSI0_DR_R = DacPair >> 16;
 
     // Disable the interrupt
     TIMER1_ICR_R = TIMER_ICR_TATOCINT;
+    countLoadSample();
+    endLoad(&mark, LOAD_SAMPLE);
+}
+
+// Modes generated ahead into the sample ring
+RAMFUNC bool streamedMode(enum mode m) {
+    return Streaming && m != raw && m != dc && m != sweep;
+}
+
+// PendSV: top the ring up in blocks, priming it from empty after a mode
+// change. Shell commands that reconfigure a generator do so between
+// StopMode and StartMode, so work that preempts them never sees a half set
+// up generator and the ISR never plays samples of the old setup.
+void ServiceStream(void) {
+    if (!streamedMode(mode))
+        return;
+    if (StreamMode != mode)
+        resetStream();
+    while (getStreamFree() >= STREAM_BLOCK) {
+        if (mode == wave)
+            serviceFlashWave();
+        else if (mode == ofdm)
+            serviceOfdm();
+        fillStream(nextSample, STREAM_BLOCK);
+    }
+    StreamMode = mode;
+}
+
+// Stop the running mode ahead of a reconfiguration: raw holds the DAC, and
+// neither the sample ISR nor PendSV touches a generator until StartMode.
+// The modulator modes share the bit source, mapper and coder, so whatever
+// runs is stopped. Returns the mode that was running.
+enum mode StopMode(void) {
+    enum mode running = mode;
+    mode = raw;
+    return running;
+}
+
+// Start (or resume) a mode after StopMode: the ring is emptied of samples of
+// the old setup and PendSV primes it again before the ISR reads from it. A
+// packet is built again for the sps, shaper and FEC now in effect, raw if
+// it no longer fits.
+void StartMode(enum mode m) {
+    if (m == packet && !rebuildPacket()) {
+        putsUart0("[!] Packet no longer fits the frame or ramps, stopped. Try help.\n\r");
+        m = raw;
+    }
+    resetStream();
+    StreamMode = raw;
+    mode = m;
+}
+
+// Next sample of the current mode as the SPI word pair, Q word low (sent first)
+RAMFUNC uint32_t nextSample(void) {
+    return modeSample(mode);
+}
+
+// Next sample of mode m, advancing that mode's generator
+RAMFUNC uint32_t modeSample(enum mode m) {
+    // Output stage settings for this sample
+    const OUTPUT_STAGE *stage = getOutputStage();
+    int32_t sI = 0, sQ = 0;
+    uint16_t wI = WRITE_I, wQ = WRITE_Q;
+
+    // Enums used used to Modulate
+    if (m == sine) {
+        // Sine (I) and Cosine (Q) from the shared table, negated so the DAC
+        // codes rise with the sine like the original lookup tables did (the
+        // output stage inverts for the analog chain)
+        sI = (-ncoSin(phase_I + stage->ch[OUT_I].phase) * I_GAIN) >> 15;
+        sQ = (-ncoCos(phase_Q + stage->ch[OUT_Q].phase) * Q_GAIN) >> 15;
+        phase_I += phi_I;
+        phase_Q += phi_Q;
+    } else if (m == symbols) {
+        // Any constellation, same mapper for every scheme
+        modulatorSample(&sI, &sQ);
+    } else if (m == fsk) {
+        // Pulse shaped frequency into the phase accumulator
+        fskSample(&sI, &sQ);
+    } else if (m == awg) {
+        // Uploaded waveform, phase accumulator addressing
+        awgSample(&sI, &sQ);
+    } else if (m == wave) {
+        // Decoded flash waveform from the double buffer
+        flashWaveSample(&sI, &sQ);
+    } else if (m == ofdm) {
+        // OFDM symbol built ahead by the main loop
+        ofdmSample(&sI, &sQ);
+    } else if (m == sweep) {
+        // Second order phase accumulator, marker on PA6
+        setPinValue(MARKER, chirpSample(&sI, &sQ));
+    } else if (m == multi) {
+        // Tone pairs on packed multiply-accumulates
+        multitoneSample(&sI, &sQ);
+    } else if (m == packet) {
+        // Prebuilt frame, ramped burst then idle gap
+        packetSample(&sI, &sQ);
+    }
+
+    // Carrier hop on top of the digital modes
+    if (Hopping && (m == symbols || m == fsk || m == packet))
+        hopSample(&sI, &sQ);
+
+    // IQ correction, gain, DC offset and saturation (raw and dc hold literal DAC codes)
+    if (m != raw && m != dc) {
+        correctSample(&stage->corr, &sI, &sQ);
+        wI = CHAN_I_START + outputSample(&stage->ch[OUT_I], sI);
+        wQ = CHAN_Q_START + outputSample(&stage->ch[OUT_Q], sQ);
+    }
+    return wQ | ((uint32_t) wI << 16);
+}
+
+// Ring statistics, or switch every mode back to the per-sample ISR path
+void StreamShell(char *OPTION) {
+    char str[60];
+    if (OPTION && strcmp(OPTION, "on") == 0) {
+        Streaming = true;
+    } else if (OPTION && strcmp(OPTION, "off") == 0) {
+        Streaming = false;
+    } else if (OPTION) {
+        putsUart0("[!] Invalid Stream Setting. Try help.\n\r");
+    } else {
+        sprintf(str, "Stream %s: %u/%u pairs, %"PRIu32" underruns\n\r", Streaming ? "on" : "off",
+                getStreamLevel(), STREAM_SIZE - 1, getStreamUnderruns());
+        putsUart0(str);
+    }
+}
+
+// Worst sample interrupt latency since the last reset; flood the shell
+// (e.g. paste a long line) while a mode runs to load the UART and PendSV
+void LatencyShell(char *OPTION) {
+    char str[60];
+    uint32_t worst = LatencyWorst, us = worst * 100 / (uint32_t) (FCYC / 1e6);
+    if (OPTION && strcmp(OPTION, "reset") == 0) {
+        LatencyWorst = 0;
+    } else if (OPTION) {
+        putsUart0("[!] Invalid Latency Setting. Try help.\n\r");
+    } else {
+        sprintf(str, "Sample ISR latency: %"PRIu32" cycles (%"PRIu32".%02"PRIu32" us) worst\n\r",
+                worst, us / 100, us % 100);
+        putsUart0(str);
+    }
+}
+
+// Microseconds x 100 from reset for a boot time stamp
+uint32_t BootMicros(uint32_t cycles) {
+    if (cycles <= BootClockCycles)
+        return (uint64_t) cycles * 100 / (uint32_t) (PIOSC / 1e6);
+    return (uint64_t) BootClockCycles * 100 / (uint32_t) (PIOSC / 1e6)
+           + (uint64_t) (cycles - BootClockCycles) * 100 / (uint32_t) (FCYC / 1e6);
+}
+
+// Main loop, once: when C init ended and the first valid pair went out
+void PrintBootLog(void) {
+    char str[80];
+    uint32_t init = BootMicros(BootMainCycles), first = BootMicros(BootSampleCycles);
+    sprintf(str, "[+] Boot: C init %"PRIu32".%02"PRIu32" us, first %s sample %"PRIu32".%02"PRIu32" us\n\r",
+            init / 100, init % 100, ModeNames[mode], first / 100, first % 100);
+    putsUart0(str);
+}
+
+// Main loop: a load interval closed, tag it with the mode it measured
+void CloseLoadInterval(void) {
+    LoadReportMode = LoadWindowMode;
+    LoadReportValid = (LoadWindowMode == mode);
+    LoadWindowMode = mode;
+    if (LoadWatch)
+        PrintLoad();
+}
+
+// Last interval: total against the peak, then where the cycles went
+void PrintLoad(void) {
+    char str[80];
+    const LOAD_REPORT *r = getLoad();
+    uint16_t total = getLoadTotal(), peak = getLoadPeak();
+    sprintf(str, "Load %s%s: %u.%02u%% (peak %u.%02u%%) over %"PRIu32" ms\n\r",
+            ModeNames[LoadReportMode], LoadReportValid ? "" : " (mode changed)",
+            total / 100, total % 100, peak / 100, peak % 100, r->cycles / (uint32_t) (FCYC / 1000));
+    putsUart0(str);
+    sprintf(str, "  isr %u.%02u%%  uart %u.%02u%%  pendsv %u.%02u%%  main %u.%02u%%\n\r",
+            getLoadPercent(r, LOAD_SAMPLE) / 100, getLoadPercent(r, LOAD_SAMPLE) % 100,
+            getLoadPercent(r, LOAD_UART) / 100, getLoadPercent(r, LOAD_UART) % 100,
+            getLoadPercent(r, LOAD_DEFER) / 100, getLoadPercent(r, LOAD_DEFER) % 100,
+            (getLoadPercent(r, LOAD_SERVICE) + getLoadPercent(r, LOAD_SHELL)) / 100,
+            (getLoadPercent(r, LOAD_SERVICE) + getLoadPercent(r, LOAD_SHELL)) % 100);
+    putsUart0(str);
+}
+
+// Load of the last interval, watch every interval, reset the peak or set
+// the interval length
+void LoadShell(char *OPTION) {
+    int ms;
+    if (!OPTION) {
+        if (getLoad()->cycles == 0)
+            putsUart0("[!] No load interval closed yet.\n\r");
+        else
+            PrintLoad();
+    } else if (strcmp(OPTION, "watch") == 0) {
+        LoadWatch = true;
+    } else if (strcmp(OPTION, "reset") == 0) {
+        resetLoadPeak();
+    } else {
+        ms = atoi(OPTION);
+        if (ms < 10 || ms > 10000) {
+            putsUart0("[!] Invalid Load Setting. Try help.\n\r");
+            return;
+        }
+        setLoadInterval(ms * (uint32_t) (FCYC / 1000));
+        LoadWindowMode = mode;
+    }
+}
+
+// Highest sample rate the current mode could run at: the cycles the last
+// interval spent per sample on output and generation, the rest of the
+// load (shell, UART) left out
+void CapacityShell(void) {
+    char str[80];
+    const LOAD_REPORT *r = getLoad();
+    uint32_t cost, fmax;
+    if (r->samples == 0 || !LoadReportValid || LoadReportMode != mode) {
+        putsUart0("[!] Run the mode for a full load interval first.\n\r");
+        return;
+    }
+    cost = (uint64_t) (r->source[LOAD_SAMPLE] + r->source[LOAD_DEFER] + r->source[LOAD_SERVICE]) * 100
+           / r->samples;
+    fmax = (uint64_t) FCYC * 100 / cost;
+    sprintf(str, "Capacity %s: %"PRIu32".%02"PRIu32" cycles/sample, max %"PRIu32" Hz\n\r",
+            ModeNames[mode], cost / 100, cost % 100, fmax);
+    putsUart0(str);
+    sprintf(str, "  at sr %"PRIu32" Hz, DAC SPI limit %"PRIu32" Hz\n\r",
+            (uint32_t) sampleRate, (uint32_t) (FDAC / 32));
+    putsUart0(str);
+}
+
+// Cycles per sample of the running mode's sample path, including the decode
+// or symbol build ahead it needs, as placed by this build (SRAM with
+// RAM_EXEC, flash without); handlers preempting it are not counted
+void ExecShell(void) {
+    char str[80];
+    enum mode running = mode;
+    LOAD_MARK mark;
+    volatile uint32_t sink;
+    uint32_t cycles;
+    uint16_t i;
+    if (running == raw || running == dc) {
+        putsUart0("[!] No sample path in raw/dc. Start a mode first.\n\r");
+        return;
+    }
+    StopMode();
+    beginLoad(&mark);
+    for (i = 0; i < EXEC_BENCH; i++) {
+        if (running == wave)
+            serviceFlashWave();
+        else if (running == ofdm)
+            serviceOfdm();
+        sink = modeSample(running);
+    }
+    cycles = (uint64_t) getLoadExclusive(&mark) * 100 / EXEC_BENCH;
+    StartMode(running);
+    (void) sink;
+    sprintf(str, "Exec %s: %s %"PRIu32".%02"PRIu32" cycles/sample\n\r", EXEC_MEMORY,
+            ModeNames[running], cycles / 100, cycles % 100);
+    putsUart0(str);
 }
 
 // Writing RAW values to DAC -> I/Q [4095, 0]
@@ -418,75 +1043,550 @@ void DCModulator(char *OPTION, float DC){
 
 
 // Modulating a Sine wave according to the parameters
-void SineModulator(char *OPTION, int f, float AMP) {
-    // LUT elements
-    int i; double Max = 4096; double temp;
-    loopval = Max;
-
+void SineModulator(char *OPTION, int f, float AMP, float PHASE, float DC) {
     // Calculating the Delta Phi for an increment in the phase
     if(strcmp(OPTION, "i") == 0) {
-        phi_I = (f * TWO_32 ) / FS;
-        Inc_B_I = phi_I >> 20;
-
+        fO_I = f;
+        phi_I = ncoFrequencyWord(f, sampleRate);
     } else if (strcmp(OPTION, "q") == 0){
-        phi_Q = (f * TWO_32 ) / FS;
-        Inc_B_Q = phi_Q >> 20;
+        fO_Q = f;
+        phi_Q = ncoFrequencyWord(f, sampleRate);
     }
 
-    // Selecting Wave streaming mode
-    if (strcmp(OPTION, "i") == 0){
-        // LUT Population For DAC I (A)
-        for (i = 0; i <= 4095; i++) {
-            temp = sin(((double) i /Max) * 2 * M_PI);
-            LUT_I[i] = (uint16_t) (((4095 - 190) / 2) * temp + (2135 + 0));
-        }
-        IntCn_I = 0;
-        IntCn_Q = 0;
-    }
-    else if(strcmp(OPTION, "q") == 0){
-       // Write the Sin function to the Channel
-       // LUT For DAC Q (B)
-       for (i = 0; i <= 4095; i++){
-           temp = cos(((double) i /Max) * 2 * M_PI);
-           LUT_Q[i] = (uint16_t) (((4095 - 175) / 2) * temp + (2135 + 0));
-        }
-       IntCn_I = 0;
-       IntCn_Q = 0;
-    }
+    // Amplitude, phase and DC go to the output stage, the table is never rebuilt
+    LevelModulator(OPTION, AMP, PHASE, DC);
+
+    // Restart both accumulators so I and Q stay phase aligned
+    phase_I = 0;
+    phase_Q = 0;
 }
 
 // Tone Modulator for Outputting I/Q
-void ToneModulator(int f, float AMP) {
+void ToneModulator(int f, float AMP, float PHASE, float DC) {
     ToneMode = true;
-    SineModulator("i", f, AMP);
-    SineModulator("q", f, AMP);
+    SineModulator("i", f, AMP, PHASE, DC);
+    SineModulator("q", f, AMP, PHASE, DC);
+}
+
+// Setting the output stage of a channel -> AMPL [0, 0.5] V (clamped), PHASE
+// deg, DC V. Gain and DC apply to every mode, PHASE only offsets the sine
+// and tone accumulators (the other modes ignore it).
+void LevelModulator(char *OPTION, float AMP, float PHASE, float DC) {
+    int32_t gain; int32_t offset;
+    uint8_t channel = (strcmp(OPTION, "q") == 0) ? OUT_Q : OUT_I;
+
+    // Full scale of a modulation (I_GAIN/Q_GAIN) is 0.5 V, AMPL = [0, 0.5] V
+    if (AMP < 0) AMP = 0;
+    if (AMP > 0.5) AMP = 0.5;
+    gain = round(AMP / 0.5 * Q15_ONE);
+    offset = round(DC * D_RES_MAX);
+    setOutputChannel(channel, gain, ncoPhaseWord(PHASE), offset);
 }
 
-// Modulating a Signal in any specified channel
+// IQ correction commands, no option prints the active matrix
+void CalibrationShell(char *OPTION) {
+    char str[80]; float m[4]; int32_t oI, oQ;
+    if (OPTION == NULL) {
+        getIqMatrix(m, &oI, &oQ);
+        sprintf(str, "I' = %.4f*I + %.4f*Q + %"PRId32"\n\r", m[0], m[1], oI);
+        putsUart0(str);
+        sprintf(str, "Q' = %.4f*I + %.4f*Q + %"PRId32"\n\r", m[2], m[3], oQ);
+        putsUart0(str);
+    } else if (strcmp(OPTION, "iq") == 0) {
+        float g = nextArg(0);
+        float p = nextArg(0);
+        oI = nextArg(0);
+        oQ = nextArg(0);
+        setIqImbalance(g, p, oI, oQ);
+    } else if (strcmp(OPTION, "save") == 0) {
+        saveIqCorrection();
+    } else if (strcmp(OPTION, "reset") == 0) {
+        resetIqCorrection();
+    } else if (strcmp(OPTION, "bench") == 0) {
+        uint32_t c = benchIqCorrection(1024);
+        sprintf(str, "Correction: %"PRIu32".%02"PRIu32" cycles/sample\n\r", c / 100, c % 100);
+        putsUart0(str);
+    } else {
+        m[0] = atof(OPTION);
+        m[1] = nextArg(0);
+        m[2] = nextArg(0);
+        m[3] = nextArg(1);
+        oI = nextArg(0);
+        oQ = nextArg(0);
+        setIqMatrix(m[0], m[1], m[2], m[3], oI, oQ);
+    }
+}
+
+// Snapshot of the running configuration
+void getConfig(CONFIG *cfg) {
+    const OUTPUT_STAGE *stage = getOutputStage();
+    // AWG, flash waveforms, OFDM, sweeps, multitones and packets are not part of the record, keep the DAC codes instead
+    cfg->mode = (mode == awg || mode == wave || mode == ofdm || mode == sweep || mode == multi
+                 || mode == packet) ? raw : mode;
+    cfg->filter = RRCFilter;
+    cfg->tone = ToneMode;
+    cfg->sampleRate = sampleRate;
+    cfg->freqI = fO_I;
+    cfg->freqQ = fO_Q;
+    cfg->rawI = WRITE_I - CHAN_I_START;
+    cfg->rawQ = WRITE_Q - CHAN_Q_START;
+    cfg->ch[OUT_I] = stage->ch[OUT_I];
+    cfg->ch[OUT_Q] = stage->ch[OUT_Q];
+    cfg->scheme = getScheme();
+    cfg->differential = getDifferential();
+    cfg->sps = getSamplesPerSymbol();
+    memset(cfg->payload, 0, PAYLOAD_MAX);
+    cfg->payloadLength = getPayload(cfg->payload);
+    cfg->fskType = FskType;
+    cfg->fskParam = FskParam;
+    cfg->prbsSource = getPrbsSource();
+    cfg->prbsOrder = getPrbs(&cfg->prbsSeed)->order;
+    cfg->prbsErrors = getPrbsErrors();
+    cfg->fecRate = getFecRate();
+    cfg->scrambler = getScrambler();
+}
+
+// Resume a saved configuration. Whatever the saved mode, this builds the
+// constellation, the RRC taps (filter on) and the FSK table of the saved
+// settings, so they are in step with what a later config save records.
+void applyConfig(const CONFIG *cfg) {
+    int8_t poly = findPrbs(cfg->prbsOrder);
+    if (cfg->mode > fsk || cfg->scheme >= SCHEME_COUNT || cfg->fskType > GMSK || poly < 0
+        || cfg->fecRate > FEC_3_4 || cfg->scrambler > SCRAMBLE_MULTIPLICATIVE)
+        return;
+    fO_I = cfg->freqI;
+    fO_Q = cfg->freqQ;
+    setSymbolRate(cfg->sampleRate);
+    setOutputChannel(OUT_I, cfg->ch[OUT_I].gain, cfg->ch[OUT_I].phase, cfg->ch[OUT_I].offset);
+    setOutputChannel(OUT_Q, cfg->ch[OUT_Q].gain, cfg->ch[OUT_Q].phase, cfg->ch[OUT_Q].offset);
+    WRITE_I = CHAN_I_START + (cfg->rawI & D_RES_MAX);
+    WRITE_Q = CHAN_Q_START + (cfg->rawQ & D_RES_MAX);
+    RRCFilter = cfg->filter;
+    ToneMode = cfg->tone;
+    setScheme((SCHEME) cfg->scheme, I_GAIN, Q_GAIN);
+    setDifferential(cfg->differential);
+    setShaping(RRCFilter);
+    setSamplesPerSymbol(cfg->sps);
+    setPayload(cfg->payload, cfg->payloadLength);
+    setPrbs(&prbsPolys[poly], cfg->prbsSeed);
+    setPrbsErrors(cfg->prbsErrors);
+    setPrbsSource(cfg->prbsSource);
+    setFecRate((FEC_RATE) cfg->fecRate);
+    setScrambler((SCRAMBLER) cfg->scrambler);
+    FskType = (FSK_TYPE) cfg->fskType;
+    FskParam = cfg->fskParam;
+    UpdateFsk();
+    phase_I = 0;
+    phase_Q = 0;
+    mode = (enum mode) cfg->mode;
+}
+
+// Returns the next shell argument as a number, or def if it was omitted
+float nextArg(float def) {
+    char *token = strtok(NULL, " ");
+    return token ? atof(token) : def;
+}
+
+// Modulating a Signal in any specified channel, data is the payload (looped)
+//  dbpsk/dqpsk/d8psk select the differential form of the PSK schemes
 void Modulator(char *OPTION, char *data) {
-    if (strcmp(OPTION, "ook") == 0){
-        //not required right now
-    } else if (strcmp(OPTION, "bpsk") == 0) {
-        mode = bpsk;
-        IntCn_I = 0;
-        IntCn_Q = 0;
-    } else if (strcmp(OPTION, "qpsk") == 0) {
-        mode = qpsk;
-        IntCn_I = 0;
-        IntCn_Q = 0;
-    } else if (strcmp(OPTION, "8psk") == 0) {
-        mode = psk8;
-        IntCn_I = 0;
-        IntCn_Q = 0;
-    } else if (strcmp(OPTION, "16qam") == 0){
-        mode = qam16;
-        IntCn_I = 0;
-        IntCn_Q = 0;
-    } else if (strcmp(OPTION, "64qam") == 0){
-        //not required right now
+    int8_t scheme = findScheme(OPTION);
+    bool differential = false;
+    if (scheme < 0 && OPTION[0] == 'd') {
+        scheme = findScheme(OPTION + 1);
+        differential = true;
+    }
+    if (scheme < 0) {
+        putsUart0("[!] Invalid Modulation. Try help.\n\r");
+        return;
+    }
+    if (differential && !pskScheme((SCHEME) scheme)) {
+        putsUart0("[!] Differential encoding needs bpsk, qpsk or 8psk.\n\r");
+        return;
+    }
+    StopMode();
+    setScheme((SCHEME) scheme, I_GAIN, Q_GAIN);
+    setPacketSource(false);
+    setDifferential(differential);
+    setPayload(data ? data : "", data ? strlen(data) : 0);
+    StartMode(symbols);
+    if (scheme == OQPSK && getSamplesPerSymbol() < 2)
+        putsUart0("[!] OQPSK needs sps >= 2 for the half symbol offset.\n\r");
+}
+
+// CPFSK/MSK/GMSK on the samples/symbol of the sps command, data as in mod
+void FskModulator(char *OPTION, float PARAM, char *data) {
+    if (strcmp(OPTION, "cpfsk") == 0) {
+        FskType = CPFSK;
+    } else if (strcmp(OPTION, "msk") == 0) {
+        FskType = MSK;
+    } else if (strcmp(OPTION, "gmsk") == 0) {
+        FskType = GMSK;
     } else {
+        putsUart0("[!] Invalid FSK Setting. Try help.\n\r");
         return;
     }
+    StopMode();
+    FskParam = PARAM;
+    UpdateFsk();
+    setPacketSource(false);
+    setPayload(data ? data : "", data ? strlen(data) : 0);
+    StartMode(fsk);
+    if (getSamplesPerSymbol() < 4)
+        putsUart0("[!] FSK works best with sps >= 4.\n\r");
+}
+
+// Rebuild the FSK table for the samples/symbol in effect, after fsk, sps
+// and filter rrc, so a running fsk mode follows an sps change
+void UpdateFsk(void) {
+    setFsk(FskType, FskParam, getSamplesPerSymbol(), I_GAIN, Q_GAIN);
+}
+
+// Upload (binary over UART0) or play back an arbitrary I/Q waveform
+void AwgModulator(char *OPTION) {
+    char str[40]; uint16_t i, n; uint8_t b[4]; int rawI = WRITE_I, rawQ = WRITE_Q; bool playing;
+    float length;
+    if (strcmp(OPTION, "load") == 0) {
+        length = nextArg(0);
+        if (!(length >= 1 && length <= AWG_MAX)) {
+            putsUart0("[!] Invalid AWG Length. Try help.\n\r");
+            return;
+        }
+        n = length;
+        // A playing waveform holds its last pair out (as the raw codes) while
+        // the buffer is rewritten, and restarts once it is loaded
+        playing = (mode == awg);
+        if (playing) {
+            WRITE_I = DacPair >> 16;
+            WRITE_Q = DacPair & 0xFFFF;
+            StopMode();
+        }
+        setAwgLength(n);
+        sprintf(str, "[+] Send %u I/Q pairs\n\r", n);
+        putsUart0(str);
+        for (i = 0; i < n; i++) {
+            // A stalled sender leaves no half written waveform to play
+            if (!UploadByte(&b[0]) || !UploadByte(&b[1]) || !UploadByte(&b[2]) || !UploadByte(&b[3])) {
+                clearAwg();
+                WRITE_I = rawI;
+                WRITE_Q = rawQ;
+                sprintf(str, "[!] AWG upload timed out at pair %u.\n\r", i);
+                putsUart0(str);
+                return;
+            }
+            writeAwgSample(i, (int16_t) (b[0] | (b[1] << 8)), (int16_t) (b[2] | (b[3] << 8)));
+        }
+        if (playing) {
+            resetAwg();
+            StartMode(awg);
+            WRITE_I = rawI;
+            WRITE_Q = rawQ;
+        }
+        putsUart0("[+] AWG loaded\n\r");
+    } else if (strcmp(OPTION, "play") == 0) {
+        char *interp;
+        float step = nextArg(1);
+        if (getAwgLength() == 0) {
+            putsUart0("[!] No AWG waveform loaded.\n\r");
+            return;
+        }
+        if (!(step > 0 && step < getAwgLength())) {
+            putsUart0("[!] Invalid AWG Step (0 < STEP < N). Try help.\n\r");
+            return;
+        }
+        interp = strtok(NULL, " ");
+        StopMode();
+        setAwgRate(step, interp && strcmp(interp, "lin") == 0);
+        resetAwg();
+        StartMode(awg);
+    } else {
+        putsUart0("[!] Invalid AWG Setting. Try help.\n\r");
+    }
+}
+
+// Next byte of a binary upload, false if none arrives within UPLOAD_TIMEOUT
+bool UploadByte(uint8_t *b) {
+    uint32_t start = CYCLES();
+    while (!kbhitUart0())
+        if (CYCLES() - start > UPLOAD_TIMEOUT * (uint32_t) (FCYC / 1000))
+            return false;
+    *b = getcUart0();
+    return true;
+}
+
+// Stream a waveform of the flash library, list it or time the decoder
+void WaveModulator(char *OPTION) {
+    char str[60]; uint8_t i; int8_t index; uint32_t c;
+    if (strcmp(OPTION, "list") == 0) {
+        for (i = 0; i < waveCount; i++) {
+            sprintf(str, "  %-12s %"PRIu32" samples\n\r", waveLibrary[i].name, waveLibrary[i].length);
+            putsUart0(str);
+        }
+        sprintf(str, "  underruns    %"PRIu32"\n\r", getFlashWaveUnderruns());
+        putsUart0(str);
+    } else if (strcmp(OPTION, "bench") == 0) {
+        c = benchFlashWave();
+        sprintf(str, "ADPCM decode: %"PRIu32".%02"PRIu32" cycles/sample\n\r", c / 100, c % 100);
+        putsUart0(str);
+    } else {
+        index = findFlashWave(OPTION);
+        if (index < 0) {
+            putsUart0("[!] Unknown waveform. Try wave list.\n\r");
+            return;
+        }
+        StopMode();
+        selectFlashWave(index);
+        StartMode(wave);
+    }
+}
+
+// OFDM on the scheme and payload of the last mod command, or time a symbol
+void OfdmModulator(char *OPTION) {
+    char str[60]; uint16_t n; uint32_t ifft, symbol; enum mode running;
+    if (strcmp(OPTION, "bench") == 0) {
+        if (getOfdmSize() == 0) {
+            putsUart0("[!] OFDM not configured. Try help.\n\r");
+            return;
+        }
+        running = StopMode();
+        benchOfdm(&ifft, &symbol);
+        sprintf(str, "IFFT %u: %"PRIu32" cycles\n\r", getOfdmSize(), ifft);
+        putsUart0(str);
+        sprintf(str, "Symbol (%u data carriers): %"PRIu32" cycles\n\r", getOfdmCarriers(), symbol);
+        putsUart0(str);
+        resetOfdm();
+        StartMode(running);
+        return;
+    }
+    n = atoi(OPTION);
+    running = StopMode();
+    setPacketSource(false);
+    if (!setOfdm(n, nextArg(n / 4), I_GAIN)) {
+        putsUart0("[!] Invalid OFDM Setting. Try help.\n\r");
+        StartMode(running == packet ? raw : running);
+        return;
+    }
+    StartMode(ofdm);
+}
+
+// Frequency sweep through the output stage of the sine modes
+void SweepModulator(float F0, float F1, float TIME, char *LAW, char *RUN) {
+    CHIRP_LAW law = LINEAR; CHIRP_REPEAT repeat = ONCE; enum mode running;
+    if (LAW && strcmp(LAW, "log") == 0)
+        law = LOGARITHMIC;
+    else if (LAW && strcmp(LAW, "lin") != 0) {
+        putsUart0("[!] Invalid Sweep Law. Try help.\n\r");
+        return;
+    }
+    if (!(TIME > 0)) {
+        putsUart0("[!] Invalid Sweep Time (> 0 s). Try help.\n\r");
+        return;
+    }
+    if (RUN && strcmp(RUN, "repeat") == 0)
+        repeat = REPEAT;
+    else if (RUN && strcmp(RUN, "updown") == 0)
+        repeat = UPDOWN;
+    else if (RUN && strcmp(RUN, "once") != 0) {
+        putsUart0("[!] Invalid Sweep Repeat. Try help.\n\r");
+        return;
+    }
+    running = StopMode();
+    setPinValue(MARKER, false);
+    if (!setChirp(F0, F1, TIME, sampleRate, law, repeat, I_GAIN, Q_GAIN)) {
+        putsUart0("[!] Invalid Sweep Setting. Try help.\n\r");
+        StartMode(running);
+        return;
+    }
+    StartMode(sweep);
+}
+
+// Build up a multitone, print its crest factor, or time it against N
+void MultitoneModulator(char *OPTION) {
+    char str[60]; float f, AMP; char *PHASE; uint8_t n; uint32_t c;
+    if (strcmp(OPTION, "add") == 0) {
+        f = nextArg(0);
+        AMP = nextArg(1);
+        PHASE = strtok(NULL, " ");
+        if (fabsf(f) >= sampleRate / 2 || !addTone(f, AMP, PHASE ? atof(PHASE) : 0, PHASE == NULL)) {
+            putsUart0("[!] Invalid Tone. Try help.\n\r");
+            return;
+        }
+        StopMode();
+        setMultitone(sampleRate, I_GAIN, Q_GAIN);
+        StartMode(multi);
+        sprintf(str, "[+] %u tones, crest factor %.1f dB%s\n\r", getToneCount(), getCrestFactor(),
+                getCrestExact() ? "" : " (estimate)");
+        putsUart0(str);
+    } else if (strcmp(OPTION, "clear") == 0) {
+        if (mode == multi)
+            StopMode();
+        clearTones();
+    } else if (strcmp(OPTION, "bench") == 0) {
+        enum mode running = StopMode();
+        for (n = 2; n <= MULTITONE_MAX; n += 2) {
+            c = benchMultitone(n);
+            sprintf(str, "  %2u tones: %"PRIu32".%02"PRIu32" cycles/sample\n\r", n, c / 100, c % 100);
+            putsUart0(str);
+        }
+        StartMode(running);
+    } else {
+        putsUart0("[!] Invalid Multitone Setting. Try help.\n\r");
+    }
+}
+
+// Bursts of DATA (or the mod payload) in the mod scheme, or the frame format
+void PacketModulator(char *OPTION, char *data) {
+    char str[60], payload[PAYLOAD_MAX + 1]; uint8_t n, preamble; uint16_t gap;
+    char *token; uint32_t sync = PACKET_SYNC; enum mode running;
+    if (OPTION && strcmp(OPTION, "format") == 0) {
+        preamble = nextArg(4);
+        token = strtok(NULL, " ");
+        if (token)
+            sync = strtoul(token, NULL, 16);
+        if (!setPacketFormat(preamble, sync, nextArg(1) != 0))
+            putsUart0("[!] Invalid Packet Format. Try help.\n\r");
+        return;
+    }
+    if (OPTION && strcmp(OPTION, "timing") == 0) {
+        gap = nextArg(16);
+        running = StopMode();
+        if (!setPacketTiming(gap, nextArg(2)))
+            putsUart0("[!] Ramp longer than half the burst. Try help.\n\r");
+        StartMode(running);
+        return;
+    }
+    running = StopMode();
+    if (OPTION) {
+        // Rejoin the first word with the rest of the line
+        snprintf(payload, sizeof(payload), "%s%s%s", OPTION, data ? " " : "", data ? data : "");
+        n = strlen(payload);
+    } else {
+        n = getPayload(payload);
+    }
+    if (!buildPacket((uint8_t *) payload, n)) {
+        putsUart0("[!] Packet too long or ramps longer than the burst. Try help.\n\r");
+        StartMode(running == packet ? raw : running);
+        return;
+    }
+    setPacketSource(true);
+    StartMode(packet);
+    sprintf(str, "[+] %u bit frame\n\r", getPacketBits());
+    putsUart0(str);
+}
+
+// ITU PRBS as the bit source of mod and fsk, with optional error injection
+void PrbsShell(char *OPTION) {
+    char *token; uint32_t seed = 0; float rate; int8_t poly; enum mode running;
+    if (strcmp(OPTION, "off") == 0) {
+        running = StopMode();
+        setPrbsSource(false);
+        StartMode(running);
+        return;
+    }
+    poly = findPrbs(atoi(OPTION));
+    if (poly < 0) {
+        putsUart0("[!] Invalid PRBS. Try help.\n\r");
+        return;
+    }
+    token = strtok(NULL, " ");
+    if (token)
+        seed = strtoul(token, NULL, 0);
+
+    // No RATE, no injection; else one error every round(1 / RATE) bits
+    token = strtok(NULL, " ");
+    rate = token ? atof(token) : 0;
+    if (token && !(rate > 0 && rate <= 1 && 1 / rate < 2147483648.0f)) {
+        putsUart0("[!] Invalid PRBS Rate (0 < RATE <= 1). Try help.\n\r");
+        return;
+    }
+    running = StopMode();
+    setPrbs(&prbsPolys[poly], seed);
+    setPrbsErrors(token ? lroundf(1 / rate) : 0);
+    setPrbsSource(true);
+    StartMode(running);
+}
+
+// Channel coding ahead of the mapper (K=7 convolutional code and scramblers)
+void FecShell(char *OPTION, bool scrambler) {
+    char str[60]; uint32_t c;
+    // Shares the coder state with the running modes
+    enum mode running = StopMode();
+    if (scrambler) {
+        if (strcmp(OPTION, "add") == 0)
+            setScrambler(SCRAMBLE_ADDITIVE);
+        else if (strcmp(OPTION, "mult") == 0)
+            setScrambler(SCRAMBLE_MULTIPLICATIVE);
+        else if (strcmp(OPTION, "off") == 0)
+            setScrambler(SCRAMBLE_OFF);
+        else
+            putsUart0("[!] Invalid Scrambler. Try help.\n\r");
+    } else if (strcmp(OPTION, "1/2") == 0) {
+        setFecRate(FEC_1_2);
+    } else if (strcmp(OPTION, "2/3") == 0) {
+        setFecRate(FEC_2_3);
+    } else if (strcmp(OPTION, "3/4") == 0) {
+        setFecRate(FEC_3_4);
+    } else if (strcmp(OPTION, "off") == 0) {
+        setFecRate(FEC_OFF);
+    } else if (strcmp(OPTION, "bench") == 0) {
+        c = benchFec();
+        sprintf(str, "FEC: %"PRIu32".%02"PRIu32" cycles/byte, %.3f bits/cycle\n\r",
+                c / 100, c % 100, c ? 800.0f / c : 0);
+        putsUart0(str);
+    } else {
+        putsUart0("[!] Invalid FEC Setting. Try help.\n\r");
+    }
+    StartMode(running);
+}
+
+// Hop table (typed in or PRNG ordered channels) and dwell timing. The
+// arguments are checked first, a rejected command leaves hopping as it was.
+void HopShell(char *OPTION) {
+    float f[HOP_MAX], channels = 0, spacing = 0, seed = 0, dwell = 0, guard = 0;
+    uint8_t n = 0, i; char *token; bool ok;
+    if (strcmp(OPTION, "off") == 0) {
+        Hopping = false;
+        return;
+    }
+    if (strcmp(OPTION, "table") == 0) {
+        ok = true;
+        while (ok && (token = strtok(NULL, " ")) != NULL) {
+            ok = n < HOP_MAX;
+            if (ok)
+                f[n++] = atof(token);
+        }
+        ok = ok && n != 0;
+        for (i = 0; ok && i < n; i++)
+            ok = fabsf(f[i]) < sampleRate / 2;
+    } else if (strcmp(OPTION, "prng") == 0) {
+        channels = nextArg(0);
+        spacing = nextArg(0);
+        seed = nextArg(1);
+        ok = channels >= 1 && channels <= HOP_MAX && channels == (uint8_t) channels
+             && fabsf(spacing) * (channels - 1) < sampleRate
+             && seed >= 0 && seed < 4294967296.0f;
+    } else if (strcmp(OPTION, "dwell") == 0) {
+        dwell = floorf(nextArg(0));
+        guard = floorf(nextArg(0));
+        ok = dwell >= 1 && dwell < 4294967296.0f && guard >= 0 && guard < dwell;
+    } else {
+        ok = false;
+    }
+    if (!ok) {
+        putsUart0("[!] Invalid Hop Setting. Try help.\n\r");
+        return;
+    }
+
+    // Accepted, hold the carrier while the hop set is rewritten
+    Hopping = false;
+    if (strcmp(OPTION, "table") == 0)
+        setHopTable(f, n);
+    else if (strcmp(OPTION, "prng") == 0)
+        generateHopTable(channels, spacing, seed);
+    else
+        setHopDwell(dwell, guard);
+    resetHop();
+    Hopping = getHopCount() != 0;
 }
 
 // Discontinued module
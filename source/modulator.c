@@ -0,0 +1,309 @@
+// Modulator Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Hardware configuration: -
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdlib.h>
+#include "inc/modulator.h"
+#include "inc/dsp.h"
+#include "inc/fir.h"
+#include "inc/prbs.h"
+#include "inc/fec.h"
+#include "inc/packet.h"
+#include "inc/ramexec.h"
+
+// Active constellation
+static CONSTELLATION cons;
+static SCHEME scheme = BPSK;
+
+// Bit source: a packet frame or PRBS when selected, else payload bytes
+// (looped) or, without payload, a symbol counter
+static bool packetSource = false;
+static bool prbsSource = false;
+static uint8_t payload[PAYLOAD_MAX];
+static uint8_t payloadLength = 0;
+static uint8_t payloadIndex = 0;
+static uint64_t reservoir = 0;          // left aligned bits not yet mapped
+static uint8_t reservoirBits = 0;
+static uint32_t walk = 0;
+
+// Symbol clock, Q rail count runs qLag samples behind the I rail
+static uint8_t samplesPerSymbol = 1;
+static uint8_t sampleCount = 0;
+static uint8_t sampleCountQ = 0;
+static uint8_t qLag = 0;
+static uint8_t pointIndex = 0;          // last mapped point (differential schemes)
+static int32_t symbolI = 0, symbolQ = 0, pendingQ = 0;
+
+// RRC shaper, an interpolating FIR so only every RRC_SPS-th tap is evaluated
+// per sample. Q15 taps against symbols in DAC LSb, rounded.
+static bool shaping = false;
+static FIR_BANK shaper;
+static FIR_LINE lineI, lineQ;
+
+// Next 32 payload bits, MSB first
+static uint32_t nextPayloadWord(void)
+{
+    uint32_t word = 0;
+    uint8_t i;
+    for (i = 0; i < 4; i++)
+    {
+        word = (word << 8) | payload[payloadIndex];
+        if (++payloadIndex == payloadLength)
+            payloadIndex = 0;
+    }
+    return word;
+}
+
+// Next 32 data bits: PRBS, payload, or zeros for the coder to scramble
+static uint32_t nextDataWord(void)
+{
+    if (prbsSource)
+        return nextPrbsWord();
+    return payloadLength ? nextPayloadWord() : 0;
+}
+
+// Next 32 source bits, packet frames are already coded
+static uint32_t nextSourceWord(void)
+{
+    if (packetSource)
+        return nextPacketWord();
+    return fecActive() ? nextFecWord(nextDataWord) : nextDataWord();
+}
+
+// Next symbol of 1..8 bits from the source (through the FEC stage when
+// enabled), shared with the FSK modes
+RAMFUNC uint32_t nextSourceBits(uint8_t bits)
+{
+    uint32_t sym;
+    if (payloadLength == 0 && !prbsSource && !packetSource && !fecActive())
+        return walk++ & ((1 << bits) - 1);
+    if (reservoirBits < bits)
+    {
+        reservoir |= (uint64_t) nextSourceWord() << (32 - reservoirBits);
+        reservoirBits += 32;
+    }
+    sym = reservoir >> (64 - bits);
+    reservoir <<= bits;
+    reservoirBits -= bits;
+    return sym;
+}
+
+// Split the RRC taps into RRC_SPS phases, normalized so the largest sum of
+// absolute taps of any phase is one (a full scale symbol stream never clips
+// beyond the rounding of the taps, which the DAC saturation absorbs)
+static void initShaper(void)
+{
+    uint8_t p, k;
+    int32_t worst = 0, sum, tap;
+    int16_t taps[RRC_TAPS];
+    for (p = 0; p < RRC_SPS; p++)
+    {
+        sum = 0;
+        for (k = p; k < RRC_TAPS; k += RRC_SPS)
+            sum += abs(rrcTaps[k]);
+        if (sum > worst)
+            worst = sum;
+    }
+    for (k = 0; k < RRC_TAPS; k++)
+    {
+        tap = rrcTaps[k];
+        taps[k] = (tap * 32767 + (tap < 0 ? -worst : worst) / 2) / worst;
+    }
+    setFirTaps(&shaper, taps, RRC_TAPS, RRC_SPS);
+}
+
+// Absolute mapping, see setDifferential
+void setScheme(SCHEME s, int32_t gainI, int32_t gainQ)
+{
+    scheme = s;
+    buildConstellation(&cons, s, gainI, gainQ);
+    resetModulator();
+}
+
+// Differential encoding of the current PSK scheme, false if not a PSK
+bool setDifferential(bool on)
+{
+    if (!makeDifferential(&cons, on))
+        return false;
+    resetModulator();
+    return true;
+}
+
+bool getDifferential(void)
+{
+    return cons.psk && cons.diffMask != 0;
+}
+
+SCHEME getScheme(void)
+{
+    return scheme;
+}
+
+uint8_t getBitsPerSymbol(void)
+{
+    return cons.bits;
+}
+
+// Payload to transmit, length 0 returns to the symbol counter
+void setPayload(const char* data, uint8_t length)
+{
+    if (length > PAYLOAD_MAX)
+        length = PAYLOAD_MAX;
+    memcpy(payload, data, length);
+    payloadLength = length;
+    resetModulator();
+}
+
+// PRBS (configured in the PRBS library) instead of the payload
+void setPrbsSource(bool on)
+{
+    prbsSource = on;
+    resetModulator();
+}
+
+bool getPrbsSource(void)
+{
+    return prbsSource;
+}
+
+// Frames of the packet library instead of PRBS or payload
+void setPacketSource(bool on)
+{
+    packetSource = on;
+    resetModulator();
+}
+
+uint8_t getPayload(char* data)
+{
+    memcpy(data, payload, payloadLength);
+    return payloadLength;
+}
+
+bool setSamplesPerSymbol(uint8_t sps)
+{
+    if (sps == 0 || sps > SPS_MAX || (shaping && sps != RRC_SPS))
+        return false;
+    samplesPerSymbol = sps;
+    resetModulator();
+    return true;
+}
+
+uint8_t getSamplesPerSymbol(void)
+{
+    return samplesPerSymbol;
+}
+
+// Symbols a burst needs after its last symbol to leave the shaper
+uint8_t getShaperDelay(void)
+{
+    return shaping ? RRC_SYMBOLS : 0;
+}
+
+// Shaper cost in cycles per tap x 100, see benchFir
+uint32_t benchShaper(void)
+{
+    if (!shaping)
+        initShaper();
+    return benchFir(&shaper, 1024);
+}
+
+// The RRC taps are fixed at RRC_SPS samples/symbol. The shaper is switched
+// out while the counters and delay lines are reset and only switched back
+// in after, so a sample taken in between never indexes a phase beyond
+// RRC_SPS or reads a half flushed line.
+void setShaping(bool on)
+{
+    shaping = false;
+    if (on)
+    {
+        initShaper();
+        samplesPerSymbol = RRC_SPS;
+    }
+    resetModulator();
+    shaping = on;
+}
+
+// Restart the symbol clock and the bit source, flush the shaper
+void resetModulator(void)
+{
+    payloadIndex = 0;
+    reservoir = 0;
+    reservoirBits = 0;
+    walk = 0;
+    resetPrbs();
+    resetFec();
+    pointIndex = 0;
+    qLag = cons.offset ? samplesPerSymbol / 2 : 0;
+    sampleCount = 0;
+    sampleCountQ = (samplesPerSymbol - qLag) % samplesPerSymbol;
+    resetFirLine(&lineI);
+    resetFirLine(&lineQ);
+}
+
+// Next mapped point of the active constellation, packed I/Q
+RAMFUNC uint32_t mapNextSymbol(void)
+{
+    pointIndex = (cons.map[nextSourceBits(cons.bits)] + (pointIndex & cons.diffMask)) & cons.pointMask;
+    return cons.point[pointIndex];
+}
+
+// Mean I^2 + Q^2 of the active constellation, for block generators to scale by
+uint32_t getSymbolPower(void)
+{
+    uint64_t sum = 0;
+    uint16_t i;
+    int32_t pI, pQ;
+    for (i = 0; i <= cons.pointMask; i++)
+    {
+        pI = (int16_t) cons.point[i];
+        pQ = (int16_t) (cons.point[i] >> 16);
+        sum += pI * pI + pQ * pQ;
+    }
+    return sum / (cons.pointMask + 1);
+}
+
+// Next baseband sample (DAC LSb around zero), called once per sample
+RAMFUNC void modulatorSample(int32_t* sI, int32_t* sQ)
+{
+    uint32_t iq;
+
+    // I rail symbol boundary: map the next symbol, Q waits for its own rail
+    if (sampleCount == 0)
+    {
+        iq = mapNextSymbol();
+        symbolI = (int16_t) iq;
+        pendingQ = (int16_t) (iq >> 16);
+        if (shaping)
+            pushFir(&shaper, &lineI, symbolI);
+    }
+    if (sampleCountQ == 0)
+    {
+        symbolQ = pendingQ;
+        if (shaping)
+            pushFir(&shaper, &lineQ, symbolQ);
+    }
+
+    if (shaping)
+    {
+        *sI = firOutput(&shaper, &lineI, sampleCount);
+        *sQ = firOutput(&shaper, &lineQ, sampleCountQ);
+    }
+    else
+    {
+        *sI = symbolI;
+        *sQ = symbolQ;
+    }
+
+    if (++sampleCount >= samplesPerSymbol)
+        sampleCount = 0;
+    if (++sampleCountQ >= samplesPerSymbol)
+        sampleCountQ = 0;
+}
@@ -0,0 +1,193 @@
+// Multitone Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Hardware configuration: -
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include "inc/multitone.h"
+#include "inc/nco.h"
+#include "inc/dsp.h"
+#include "inc/cycle.h"
+#include "inc/ramexec.h"
+
+#define CREST_MARGIN 0.95f              // headroom over the simulated peak
+
+// Tone list as entered
+static float toneFreq[MULTITONE_MAX];
+static float toneAmplitude[MULTITONE_MAX];
+static float tonePhase[MULTITONE_MAX];  // degrees
+static bool toneNewman[MULTITONE_MAX];
+static uint8_t toneCount = 0;
+
+// Generator, odd counts are padded with a silent tone
+static uint32_t step[MULTITONE_MAX];
+static uint32_t start[MULTITONE_MAX];
+static uint32_t phase[MULTITONE_MAX];
+static uint32_t amplitude[MULTITONE_MAX / 2];   // packed Q15 pairs (tone 2k low)
+static uint8_t pairs = 0;
+static float crest = 0;
+static bool crestExact = false;         // peak searched over the common period
+
+// Append a tone, amplitude relative (0, 1]; newman ignores degrees
+bool addTone(float f, float amp, float degrees, bool newman)
+{
+    if (toneCount == MULTITONE_MAX || amp <= 0 || amp > 1)
+        return false;
+    toneFreq[toneCount] = f;
+    toneAmplitude[toneCount] = amp;
+    tonePhase[toneCount] = degrees;
+    toneNewman[toneCount] = newman;
+    toneCount++;
+    return true;
+}
+
+void clearTones(void)
+{
+    toneCount = 0;
+    pairs = 0;
+}
+
+uint8_t getToneCount(void)
+{
+    return toneCount;
+}
+
+// Samples after which every accumulator is back at its start phase: 2^32
+// over the largest power of two dividing all the frequency words
+static uint64_t commonPeriod(void)
+{
+    uint32_t bits = 0;
+    uint8_t k;
+    for (k = 0; k < toneCount; k++)
+        bits |= step[k];
+    return bits ? (1ull << 32) / (bits & -bits) : 1;
+}
+
+// Peak |I| or |Q| and per-axis RMS of the sum for amplitudes a (Q15), over
+// the samples multitoneSample produces (phases advance before the lookup)
+static void simulate(const int32_t* a, float* peak, float* rms)
+{
+    uint32_t p[MULTITONE_MAX];
+    uint64_t period = commonPeriod();
+    uint16_t n, window;
+    uint8_t k;
+    int64_t sI, sQ, m = 0;
+    float power = 0;
+    crestExact = period <= CREST_SAMPLES;
+    window = crestExact ? period : CREST_SAMPLES;
+    for (k = 0; k < toneCount; k++)
+        p[k] = start[k];
+    for (n = 0; n < window; n++)
+    {
+        sI = 0;
+        sQ = 0;
+        for (k = 0; k < toneCount; k++)
+        {
+            p[k] += step[k];
+            sI += (int64_t) a[k] * ncoSin(p[k]);
+            sQ += (int64_t) a[k] * ncoCos(p[k]);
+        }
+        sI >>= 15;
+        sQ >>= 15;
+        if (sI < 0) sI = -sI;
+        if (sQ < 0) sQ = -sQ;
+        if (sI > m) m = sI;
+        if (sQ > m) m = sQ;
+        power += (float) sI * sI + (float) sQ * sQ;
+    }
+    *peak = m;
+    *rms = sqrtf(power / (2 * window));
+}
+
+// Frequency words, Newman phases and crest scaled amplitudes; call with
+// the mode stopped and again after a sample rate change
+void setMultitone(float fs, int32_t gainI, int32_t gainQ)
+{
+    int32_t a[MULTITONE_MAX];
+    int32_t gain = (gainI < gainQ) ? gainI : gainQ;
+    float peak, rms, scale;
+    uint8_t k;
+
+    for (k = 0; k < MULTITONE_MAX; k++)
+    {
+        step[k] = 0;
+        start[k] = 0;
+        a[k] = 0;
+    }
+    for (k = 0; k < toneCount; k++)
+    {
+        step[k] = ncoFrequencyWord(toneFreq[k], fs);
+        start[k] = toneNewman[k] ? ncoPhaseWord(180.0f * k * k / toneCount)
+                                 : ncoPhaseWord(tonePhase[k]);
+        a[k] = lroundf(toneAmplitude[k] * 32767);
+    }
+    pairs = (toneCount + 1) / 2;
+    if (toneCount == 0)
+        return;
+
+    simulate(a, &peak, &rms);
+    crest = 20 * log10f(peak / rms);
+    scale = CREST_MARGIN * gain / peak;
+    for (k = 0; k < pairs; k++)
+        amplitude[k] = PACK16(lroundf(a[2 * k] * scale), lroundf(a[2 * k + 1] * scale));
+    resetMultitone();
+}
+
+// Peak to RMS of the sum in dB
+float getCrestFactor(void)
+{
+    return crest;
+}
+
+// True if the crest factor is exact, false if estimated over CREST_SAMPLES
+bool getCrestExact(void)
+{
+    return crestExact;
+}
+
+// Restart every tone at its start phase, call with the mode stopped
+void resetMultitone(void)
+{
+    uint8_t k;
+    for (k = 0; k < MULTITONE_MAX; k++)
+        phase[k] = start[k];
+}
+
+RAMFUNC void multitoneSample(int32_t* sI, int32_t* sQ)
+{
+    int32_t accI = 0, accQ = 0;
+    uint32_t p0, p1;
+    uint8_t k;
+    for (k = 0; k < pairs; k++)
+    {
+        p0 = phase[2 * k] += step[2 * k];
+        p1 = phase[2 * k + 1] += step[2 * k + 1];
+        accI = SMLAD(PACK16(ncoSin(p0), ncoSin(p1)), amplitude[k], accI);
+        accQ = SMLAD(PACK16(ncoCos(p0), ncoCos(p1)), amplitude[k], accQ);
+    }
+    *sI = accI >> 15;
+    *sQ = accQ >> 15;
+}
+
+// Cycles/sample x100 with n tones, call with the mode stopped
+uint32_t benchMultitone(uint8_t n)
+{
+    uint8_t saved = pairs;
+    uint32_t begin, stop;
+    uint16_t i;
+    int32_t sI, sQ;
+    pairs = (n + 1) / 2;
+    begin = CYCLES();
+    for (i = 0; i < 256; i++)
+        multitoneSample(&sI, &sQ);
+    stop = CYCLES();
+    pairs = saved;
+    resetMultitone();
+    return ((stop - begin) * 100) / 256;
+}
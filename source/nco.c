@@ -0,0 +1,28 @@
+// NCO Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Hardware configuration: -
+
+
+#include <stdint.h>
+#include <math.h>
+#include "inc/nco.h"
+
+// Phase increment per sample for frequency f at sample rate fs, negative f wraps
+uint32_t ncoFrequencyWord(float f, float fs)
+{
+    double cycles = (double) f / fs;
+    cycles -= floor(cycles);
+    return (uint32_t) (cycles * 4294967296.0);
+}
+
+// Phase offset for an angle in degrees
+uint32_t ncoPhaseWord(float degrees)
+{
+    double turns = degrees / 360.0;
+    turns -= floor(turns);
+    return (uint32_t) (turns * 4294967296.0);
+}
@@ -9,6 +9,7 @@
 
 #include <tm4c123gh6pm.h>
 #include "inc/nvic.h"
+#include "inc/ramexec.h"
 
 void enableNvicInterrupt(uint8_t vectorNumber)
 {
@@ -36,3 +37,14 @@ void setNvicInterruptPriority(uint8_t vectorNumber, uint8_t priority)
     *p |= priority << shift;
 }
 
+// PendSV is a system exception, its priority lives in SYS_PRI3
+void setNvicPendSvPriority(uint8_t priority)
+{
+    NVIC_SYS_PRI3_R = (NVIC_SYS_PRI3_R & ~NVIC_SYS_PRI3_PENDSV_M) | ((uint32_t) priority << NVIC_SYS_PRI3_PENDSV_S);
+}
+
+RAMFUNC void pendNvicPendSv(void)
+{
+    NVIC_INT_CTRL_R = NVIC_INT_CTRL_PEND_SV;
+}
+
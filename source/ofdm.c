@@ -0,0 +1,289 @@
+// OFDM Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Hardware configuration: -
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include "inc/ofdm.h"
+#include "inc/modulator.h"
+#include "inc/nco.h"
+#include "inc/dsp.h"
+#include "inc/cycle.h"
+#include "inc/ramexec.h"
+
+#define OFDM_HEADROOM 3                 // mapper points are << 3 into the Q15 IFFT input
+#define OFDM_MULT_SHIFT 12
+
+static uint16_t size = 0;               // 0 = not configured
+static uint16_t prefix = 0;
+static uint16_t used = 0;               // active carriers each side of DC
+static int32_t pilot = 0;
+static int32_t mult = 0;                // IFFT output to DAC LSb, Q12
+static uint16_t perm[OFDM_MAX];         // IFFT output position -> time index
+
+// Frequency domain symbol, transformed in place (packed Q15 I/Q)
+static uint32_t freq[OFDM_MAX];
+
+// Double buffer shared with the sample ISR, prefix + symbol
+static uint32_t block[2][OFDM_MAX + OFDM_CP_MAX];
+static volatile bool blockReady[2];
+static uint8_t playing = 0;
+static uint16_t position = 0;
+static volatile uint32_t underruns = 0;
+
+// Q15 e^(+j 2 pi t / n), packed
+static inline uint32_t twiddle(uint32_t t, uint16_t n)
+{
+    uint32_t phase = t * (0x80000000u / n) * 2;
+    return PACK16(ncoCos(phase), ncoSin(phase));
+}
+
+// (x * w) >> 15 for packed complex values
+static inline uint32_t rotate(uint32_t x, uint32_t w)
+{
+    return PACK16(SMUSD(x, w) >> 15, SMUADX(x, w) >> 15);
+}
+
+// In place decimation in frequency IFFT of n = 64, 128 or 256 packed Q15
+// points: radix-4 stages while four divides the span, a final radix-2
+// stage for 128. Every stage halves twice (once for radix-2), so the
+// result is (1/n) sum X[k] e^(+j 2 pi k t / n), truncated, and cannot
+// overflow for points within the Q15 unit circle (mapper points and
+// pilots << OFDM_HEADROOM are). Output is in mixed radix digit reversed
+// order, see perm[]. tools/ofdmcheck.c holds it against a scalar model and
+// a double IDFT.
+void ifftQ15(uint32_t* x, uint16_t n)
+{
+    uint16_t span, q, j, g;
+    uint32_t a, b, c, d, s0, s1, u, t, step;
+    uint32_t* p;
+
+    for (span = n; span >= 4 && (span & 3) == 0; span >>= 2)
+    {
+        q = span >> 2;
+        step = n / span;
+        for (g = 0; g < n; g += span)
+        {
+            p = &x[g];
+            for (j = 0; j < q; j++)
+            {
+                a = p[j];
+                b = p[j + q];
+                c = p[j + 2 * q];
+                d = p[j + 3 * q];
+                s0 = SHADD16(a, c);
+                s1 = SHADD16(b, d);
+                u = SHSUB16(a, c);
+                t = SHSUB16(b, d);
+                p[j] = SHADD16(s0, s1);
+                if (j == 0)
+                {
+                    p[j + q] = SHASX(u, t);         // (a - c) + j (b - d)
+                    p[j + 2 * q] = SHSUB16(s0, s1);
+                    p[j + 3 * q] = SHSAX(u, t);     // (a - c) - j (b - d)
+                }
+                else
+                {
+                    p[j + q] = rotate(SHASX(u, t), twiddle(j * step, n));
+                    p[j + 2 * q] = rotate(SHSUB16(s0, s1), twiddle(2 * j * step, n));
+                    p[j + 3 * q] = rotate(SHSAX(u, t), twiddle(3 * j * step, n));
+                }
+            }
+        }
+    }
+    if (span == 2)
+    {
+        for (g = 0; g < n; g += 2)
+        {
+            a = x[g];
+            b = x[g + 1];
+            x[g] = SHADD16(a, b);
+            x[g + 1] = SHSUB16(a, b);
+        }
+    }
+}
+
+// Output position -> frequency (here time) index for the stage radices above
+static void buildPermutation(uint16_t n)
+{
+    uint16_t pos, rest, span, radix, k, weight;
+    for (pos = 0; pos < n; pos++)
+    {
+        rest = pos;
+        k = 0;
+        weight = 1;
+        for (span = n; span > 1; span /= radix)
+        {
+            radix = ((span & 3) == 0) ? 4 : 2;
+            k += (rest / (span / radix)) * weight;
+            rest %= span / radix;
+            weight *= radix;
+        }
+        perm[pos] = k;
+    }
+}
+
+static uint16_t pilotsPerSide(void)
+{
+    return (used + OFDM_PILOT_STEP / 2) / OFDM_PILOT_STEP;
+}
+
+// Carrier k (-n/2..n/2-1): 0 null, 1 data, 2 pilot
+static uint8_t carrierType(int16_t k)
+{
+    int16_t m = (k < 0) ? -k : k;
+    if (m == 0 || m > used)
+        return 0;
+    return ((m + OFDM_PILOT_STEP / 2) % OFDM_PILOT_STEP == 0) ? 2 : 1;
+}
+
+// Map, transform and prefix one OFDM symbol into a block
+static void buildSymbol(uint32_t* out)
+{
+    int16_t k;
+    uint16_t i, bin;
+    uint32_t iq;
+    int32_t xI, xQ;
+
+    for (k = -(int16_t) (size / 2); k < (int16_t) (size / 2); k++)
+    {
+        bin = k & (size - 1);
+        switch (carrierType(k))
+        {
+        case 1:
+            iq = mapNextSymbol();
+            freq[bin] = PACK16((int16_t) iq * (1 << OFDM_HEADROOM), (int16_t) (iq >> 16) * (1 << OFDM_HEADROOM));
+            break;
+        case 2:
+            freq[bin] = PACK16(pilot, 0);
+            break;
+        default:
+            freq[bin] = 0;
+        }
+    }
+    ifftQ15(freq, size);
+    for (i = 0; i < size; i++)
+    {
+        xI = ((int16_t) freq[i] * mult) >> OFDM_MULT_SHIFT;
+        xQ = ((int16_t) (freq[i] >> 16) * mult) >> OFDM_MULT_SHIFT;
+        out[prefix + perm[i]] = PACK16(xI, xQ);
+    }
+    for (i = 0; i < prefix; i++)
+        out[i] = out[size + i];
+}
+
+// Configure size and prefix, call with the mode stopped and the mod
+// scheme selected. Output is scaled for a per-axis RMS of gainI / 4.
+bool setOfdm(uint16_t n, uint16_t cp, int32_t gainI)
+{
+    float rms;
+    if ((n != 64 && n != 128 && n != 256) || cp > n / 4)
+        return false;
+    size = n;
+    prefix = cp;
+    used = n * 26 / 64;
+    pilot = gainI * (1 << OFDM_HEADROOM);
+    buildPermutation(n);
+
+    // Per-axis RMS at the IFFT output: data and pilot carriers over n
+    rms = sqrtf(((used - pilotsPerSide()) * (float) getSymbolPower()
+        + pilotsPerSide() * (float) gainI * gainI)) * (1 << OFDM_HEADROOM) / n;
+    mult = lroundf(gainI / 4.0f / rms * (1 << OFDM_MULT_SHIFT));
+    resetOfdm();
+    return true;
+}
+
+uint16_t getOfdmSize(void)
+{
+    return size;
+}
+
+uint16_t getOfdmPrefix(void)
+{
+    return prefix;
+}
+
+// Data carriers per symbol
+uint16_t getOfdmCarriers(void)
+{
+    return 2 * (used - pilotsPerSide());
+}
+
+// Restart with both blocks primed, call with the mode stopped
+void resetOfdm(void)
+{
+    playing = 0;
+    position = 0;
+    underruns = 0;
+    if (size == 0)
+        return;
+    resetModulator();
+    buildSymbol(block[0]);
+    blockReady[0] = true;
+    buildSymbol(block[1]);
+    blockReady[1] = true;
+}
+
+// Main loop: build the next symbol into whichever block the ISR released,
+// true if it did
+bool serviceOfdm(void)
+{
+    uint8_t b;
+    bool built = false;
+    if (size == 0)
+        return false;
+    for (b = 0; b < 2; b++)
+        if (!blockReady[b])
+        {
+            buildSymbol(block[b]);
+            blockReady[b] = true;
+            built = true;
+        }
+    return built;
+}
+
+// Next sample, releases a block when it has been played out
+RAMFUNC void ofdmSample(int32_t* sI, int32_t* sQ)
+{
+    uint32_t iq;
+    if (!blockReady[playing])
+    {
+        underruns++;
+        *sI = 0;
+        *sQ = 0;
+        return;
+    }
+    iq = block[playing][position];
+    *sI = (int16_t) iq;
+    *sQ = (int16_t) (iq >> 16);
+    if (++position == size + prefix)
+    {
+        blockReady[playing] = false;
+        playing ^= 1;
+        position = 0;
+    }
+}
+
+uint32_t getOfdmUnderruns(void)
+{
+    return underruns;
+}
+
+// Cycles for the IFFT alone and for a whole symbol (map, IFFT, scale,
+// prefix) at the configured size, call with the mode stopped
+void benchOfdm(uint32_t* ifftCycles, uint32_t* symbolCycles)
+{
+    uint32_t start;
+    start = CYCLES();
+    ifftQ15(freq, size);
+    *ifftCycles = CYCLES() - start;
+    start = CYCLES();
+    buildSymbol(block[0]);
+    *symbolCycles = CYCLES() - start;
+}
@@ -0,0 +1,53 @@
+// Output Stage Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Hardware configuration: -
+
+
+#include <stdint.h>
+#include "inc/output.h"
+
+// Active copy is read by the sample ISR, the other one is edited by the shell
+OUTPUT_STAGE outputStage[2];
+volatile uint8_t outputActive = 0;
+
+// Identity correction, unity gain, no phase or DC offset on both channels
+void initOutputStage(void)
+{
+    uint8_t i;
+    outputStage[0].corr.rowI = PACK16(32767, 0);
+    outputStage[0].corr.rowQ = PACK16(0, 32767);
+    outputStage[0].corr.offsetI = 0;
+    outputStage[0].corr.offsetQ = 0;
+    for (i = 0; i < 2; i++)
+    {
+        outputStage[0].ch[i].gain = Q15_ONE;
+        outputStage[0].ch[i].phase = 0;
+        outputStage[0].ch[i].offset = 0;
+    }
+    outputStage[1] = outputStage[0];
+    outputActive = 0;
+}
+
+// Update one channel, the sample ISR sees either the old or the new settings
+void setOutputChannel(uint8_t channel, int32_t gain, uint32_t phase, int32_t offset)
+{
+    uint8_t next = outputActive ^ 1;
+    outputStage[next] = outputStage[outputActive];
+    outputStage[next].ch[channel].gain = gain;
+    outputStage[next].ch[channel].phase = phase;
+    outputStage[next].ch[channel].offset = offset;
+    outputActive = next;
+}
+
+// Replace the IQ correction, same hand-over as setOutputChannel
+void setOutputCorrection(const OUTPUT_CORRECTION* corr)
+{
+    uint8_t next = outputActive ^ 1;
+    outputStage[next] = outputStage[outputActive];
+    outputStage[next].corr = *corr;
+    outputActive = next;
+}
@@ -0,0 +1,264 @@
+// Packet Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Hardware configuration: -
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include "inc/packet.h"
+#include "inc/modulator.h"
+#include "inc/fec.h"
+#include "inc/ramexec.h"
+
+// Frame format
+static uint8_t preambleBytes = 4;
+static uint32_t syncWord = PACKET_SYNC;
+static bool crcOn = true;
+static uint16_t gapSymbols = 16;
+static uint8_t rampSymbols = 2;
+
+// Assembled frame, MSB first
+static uint8_t frame[PACKET_MAX];
+static uint16_t frameBits = 0;
+static uint16_t frameIndex = 0;         // next byte for the modulator
+
+// Payload of the last frame built, to rebuild it for new settings
+static uint8_t payload[PAYLOAD_MAX];
+static uint8_t payloadLength = 0;
+static bool built = false;
+
+// Burst timing in samples, envelope ramp in Q15
+static uint32_t burstSamples = 0;
+static uint32_t periodSamples = 0;
+static uint16_t rampSamples = 0;
+static int16_t ramp[PACKET_RAMP_MAX];
+static uint32_t position = 0;
+
+// Coder input while building (payload, CRC and a flush byte)
+static uint8_t coderIn[PAYLOAD_MAX + 6];
+static uint8_t coderLength = 0;
+static uint8_t coderIndex = 0;
+
+bool setPacketFormat(uint8_t preamble, uint32_t sync, bool crc)
+{
+    if (preamble > PACKET_PREAMBLE_MAX)
+        return false;
+    preambleBytes = preamble;
+    syncWord = sync;
+    crcOn = crc;
+    return true;
+}
+
+// Size the burst of the built frame for the current scheme, samples/symbol
+// and shaper delay, false (nothing changed) if the ramps would not fit
+static bool sizeBurst(uint16_t gap, uint8_t rampLength)
+{
+    uint8_t sps = getSamplesPerSymbol();
+    uint32_t symbols, burst;
+    uint16_t i, n = (uint16_t) rampLength * sps;
+
+    // Burst: whole symbols of the frame plus the shaper delay
+    symbols = (frameBits + getBitsPerSymbol() - 1) / getBitsPerSymbol() + getShaperDelay();
+    burst = symbols * sps;
+    if (n > PACKET_RAMP_MAX || 2 * n > burst)
+        return false;
+    gapSymbols = gap;
+    rampSymbols = rampLength;
+    burstSamples = burst;
+    periodSamples = burst + (uint32_t) gap * sps;
+    rampSamples = n;
+    for (i = 0; i < n; i++)
+        ramp[i] = lroundf(16383.5f * (1 - cosf((float) M_PI * (i + 0.5f) / n)));
+    return true;
+}
+
+// Gap between bursts and envelope ramp length, in symbols. Applies to the
+// built frame at once (call with the mode stopped), false if each ramp
+// would be longer than half the burst or PACKET_RAMP_MAX samples.
+bool setPacketTiming(uint16_t gap, uint8_t rampLength)
+{
+    if (!built)
+    {
+        gapSymbols = gap;
+        rampSymbols = rampLength;
+        return true;
+    }
+    return sizeBurst(gap, rampLength);
+}
+
+// CRC-16/CCITT-FALSE (0x1021, init 0xFFFF)
+static uint16_t crc16(const uint8_t* data, uint8_t length)
+{
+    uint16_t crc = 0xFFFF;
+    uint8_t i, b;
+    for (i = 0; i < length; i++)
+    {
+        crc ^= data[i] << 8;
+        for (b = 0; b < 8; b++)
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+static uint32_t nextCoderWord(void)
+{
+    uint32_t word = 0;
+    uint8_t i;
+    for (i = 0; i < 4; i++)
+    {
+        word = (word << 8) | ((coderIndex < coderLength) ? coderIn[coderIndex] : 0);
+        coderIndex++;
+    }
+    return word;
+}
+
+// Coded bits for n coder input bytes at the current FEC rate
+static uint16_t codedBits(uint8_t n)
+{
+    switch (getFecRate())
+    {
+    case FEC_1_2:
+        return n * 16;
+    case FEC_2_3:
+        return n * 12;
+    case FEC_3_4:
+        return n * 32 / 3;
+    default:
+        return n * 8;
+    }
+}
+
+// Assemble preamble, sync, payload and CRC and size the burst for the
+// current scheme, samples/symbol and FEC; call with the mode stopped. False
+// if the coded frame exceeds PACKET_MAX or the ramps do not fit the burst,
+// no frame is built then.
+bool buildPacket(const uint8_t* data, uint8_t length)
+{
+    uint16_t n = 0, bits, i;
+    uint16_t crc;
+    uint32_t word;
+
+    built = false;
+    if (length > PAYLOAD_MAX)
+        return false;
+    memset(frame, 0, PACKET_MAX);
+    for (i = 0; i < preambleBytes; i++)
+        frame[n++] = 0xAA;
+    for (i = 0; i < 4; i++)
+        frame[n++] = syncWord >> (24 - 8 * i);
+
+    memcpy(coderIn, data, length);
+    coderLength = length;
+    if (crcOn)
+    {
+        crc = crc16(data, length);
+        coderIn[coderLength++] = crc >> 8;
+        coderIn[coderLength++] = crc;
+    }
+    if (getFecRate() != FEC_OFF)
+    {
+        // Flush the encoder back to state 0, 3/4 codes three bytes at a time
+        coderIn[coderLength++] = 0;
+        while (getFecRate() == FEC_3_4 && coderLength % 3)
+            coderIn[coderLength++] = 0;
+    }
+
+    // Payload and CRC, through the scrambler and FEC when enabled
+    bits = codedBits(coderLength);
+    if (n + (bits + 31) / 32 * 4 > PACKET_MAX)
+        return false;
+    coderIndex = 0;
+    if (fecActive())
+    {
+        resetFec();
+        for (i = 0; i < bits; i += 32)
+        {
+            word = nextFecWord(nextCoderWord);
+            frame[n + i / 8] = word >> 24;
+            frame[n + i / 8 + 1] = word >> 16;
+            frame[n + i / 8 + 2] = word >> 8;
+            frame[n + i / 8 + 3] = word;
+        }
+        // Drop code bits past the end of the frame
+        if (bits % 8)
+            frame[n + bits / 8] &= 0xFF00 >> (bits % 8);
+        for (i = (bits + 7) / 8; i < (bits + 31) / 32 * 4; i++)
+            frame[n + i] = 0;
+    }
+    else
+        memcpy(&frame[n], coderIn, coderLength);
+    frameBits = n * 8 + bits;
+    if (!sizeBurst(gapSymbols, rampSymbols))
+        return false;
+
+    memmove(payload, data, length);
+    payloadLength = length;
+    built = true;
+    resetPacket();
+    return true;
+}
+
+// Build the last frame again after the scheme, samples/symbol, shaper or
+// FEC changed; call with the mode stopped, false if there is none or it no
+// longer fits
+bool rebuildPacket(void)
+{
+    return built && buildPacket(payload, payloadLength);
+}
+
+uint16_t getPacketBits(void)
+{
+    return frameBits;
+}
+
+// Next 32 frame bits for the modulator, zeros past the end of the frame
+uint32_t nextPacketWord(void)
+{
+    uint32_t word = 0;
+    uint8_t i;
+    for (i = 0; i < 4; i++)
+    {
+        word = (word << 8) | ((frameIndex < PACKET_MAX) ? frame[frameIndex] : 0);
+        frameIndex++;
+    }
+    return word;
+}
+
+// Start of a burst: frame from the top, modulator clock restarted
+void resetPacket(void)
+{
+    position = 0;
+    frameIndex = 0;
+}
+
+// Burst samples with ramped edges, then idle until the period ends
+RAMFUNC void packetSample(int32_t* sI, int32_t* sQ)
+{
+    int32_t env = 32767;
+    if (position < burstSamples)
+    {
+        modulatorSample(sI, sQ);
+        if (position < rampSamples)
+            env = ramp[position];
+        else if (position >= burstSamples - rampSamples)
+            env = ramp[burstSamples - 1 - position];
+        *sI = (*sI * env) >> 15;
+        *sQ = (*sQ * env) >> 15;
+    }
+    else
+    {
+        *sI = 0;
+        *sQ = 0;
+    }
+    if (++position == periodSamples)
+    {
+        resetModulator();
+        resetPacket();
+    }
+}
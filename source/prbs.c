@@ -0,0 +1,103 @@
+// PRBS Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Hardware configuration: -
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/prbs.h"
+
+const PRBS_POLY prbsPolys[] =
+{
+    {7, 6, false},
+    {9, 5, false},
+    {15, 14, true},
+    {23, 18, true},
+    {31, 28, true},
+};
+const uint8_t prbsPolyCount = sizeof(prbsPolys) / sizeof(prbsPolys[0]);
+
+static PRBS_POLY poly = {9, 5, false};
+static uint32_t seed = 0x1FF;
+static uint32_t state = 0x1FF;          // newest bit in bit 0
+static uint32_t errorInterval = 0;      // bits between injected errors, 0 = off
+static uint32_t errorCount = 0;         // bits until the next error
+
+int8_t findPrbs(uint8_t order)
+{
+    uint8_t i;
+    for (i = 0; i < prbsPolyCount; i++)
+        if (prbsPolys[i].order == order)
+            return i;
+    return -1;
+}
+
+// Any trinomial with 0 < k < m <= 31, seed 0 means all ones
+bool setPrbs(const PRBS_POLY* p, uint32_t s)
+{
+    uint32_t mask;
+    if (p->order > 31 || p->tap == 0 || p->tap >= p->order)
+        return false;
+    mask = (1u << p->order) - 1;
+    s &= mask;
+    poly = *p;
+    seed = s ? s : mask;
+    resetPrbs();
+    return true;
+}
+
+// Active polynomial and its (non-zero) seed
+const PRBS_POLY* getPrbs(uint32_t* s)
+{
+    *s = seed;
+    return &poly;
+}
+
+// One flipped bit every interval bits (BER = 1 / interval), 0 turns it off
+void setPrbsErrors(uint32_t interval)
+{
+    errorInterval = interval;
+    errorCount = interval;
+}
+
+uint32_t getPrbsErrors(void)
+{
+    return errorInterval;
+}
+
+void resetPrbs(void)
+{
+    state = seed;
+    errorCount = errorInterval;
+}
+
+// Next 32 bits, first bit in the MSB
+uint32_t nextPrbsWord(void)
+{
+    uint32_t word = 0, chunk;
+    uint8_t have = 0, w;
+    while (have < 32)
+    {
+        w = (32 - have < poly.tap) ? 32 - have : poly.tap;
+        chunk = ((state >> (poly.tap - w)) ^ (state >> (poly.order - w))) & ((1u << w) - 1);
+        state = ((state << w) | chunk) & ((1u << poly.order) - 1);
+        word = (word << w) | chunk;
+        have += w;
+    }
+    if (poly.invert)
+        word = ~word;
+
+    // Error injection, errorCount counts down across words
+    while (errorInterval != 0 && errorCount <= 32)
+    {
+        word ^= 0x80000000u >> (errorCount - 1);
+        errorCount += errorInterval;
+    }
+    if (errorInterval != 0)
+        errorCount -= 32;
+    return word;
+}
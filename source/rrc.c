@@ -0,0 +1,17 @@
+// RRC Filter Taps
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Hardware configuration: -
+
+
+#include <stdint.h>
+#include "inc/rrc.h"
+
+// Filter Coefficients [rrc, order=30, fs/fc = 8, alpha=0.25], Q15
+const int16_t rrcTaps[RRC_TAPS] = {   75,  -141,  -334,  -295,    49,   521,   754,   426,
+                                    -446, -1383, -1615,  -524,  1943,  5089,  7723,  8752,
+                                    7723,  5089,  1943,  -524, -1615, -1383,  -446,   426,
+                                     754,   521,    49,  -295,  -334,  -141,    75};
@@ -0,0 +1,71 @@
+// Sample Stream Library
+
+// Target Platform: EK-TM4C123GXL
+// Target uC:       TM4C123GH6PM
+// System Clock:    -
+
+// Hardware configuration: -
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/stream.h"
+#include "inc/ramexec.h"
+
+#define STREAM_MASK (STREAM_SIZE - 1)
+
+static uint32_t ring[STREAM_SIZE];
+static volatile uint16_t head = 0;      // next write, generator only
+static volatile uint16_t tail = 0;      // next read, ISR only
+static volatile uint32_t underruns = 0;
+
+// Empty the ring, call while the ISR is not reading it
+void resetStream(void)
+{
+    head = 0;
+    tail = 0;
+    underruns = 0;
+}
+
+// Pairs the ring holds
+RAMFUNC uint16_t getStreamLevel(void)
+{
+    return (head - tail) & STREAM_MASK;
+}
+
+// Pairs the generator may write (one slot stays empty to tell full from empty)
+RAMFUNC uint16_t getStreamFree(void)
+{
+    return STREAM_MASK - getStreamLevel();
+}
+
+// Generate n pairs into the ring, n <= getStreamFree()
+RAMFUNC void fillStream(STREAM_SOURCE source, uint16_t n)
+{
+    uint16_t h = head;
+    while (n--)
+    {
+        ring[h] = source();
+        h = (h + 1) & STREAM_MASK;
+    }
+    head = h;
+}
+
+// Sample ISR: next pair, false (and counted) when the generator fell behind
+RAMFUNC bool readStream(uint32_t* pair)
+{
+    uint16_t t = tail;
+    if (t == head)
+    {
+        underruns++;
+        return false;
+    }
+    *pair = ring[t];
+    tail = (t + 1) & STREAM_MASK;
+    return true;
+}
+
+uint32_t getStreamUnderruns(void)
+{
+    return underruns;
+}
@@ -35,6 +35,14 @@ SECTIONS
     .pinit  :   > FLASH
     .init_array : > FLASH
 
+#ifdef RAM_EXEC
+    /* Sample path: loaded in flash, copied to SRAM by the boot routine */
+    /* (inc/ramexec.h; link with --define=RAM_EXEC)                    */
+    .TI.ramfunc : load = FLASH, run = SRAM, table(BINIT)
+    .ramconst   : load = FLASH, run = SRAM, table(BINIT)
+    .binit      : > FLASH
+#endif
+
     .vtable :   > 0x20000000
     .data   :   > SRAM
     .bss    :   > SRAM
@@ -41,6 +41,7 @@ static void IntDefaultHandler(void);
 //
 //*****************************************************************************
 extern void _c_int00(void);
+extern void initCycleCounter(void);
 extern void timer1Isr(void);
 
 //*****************************************************************************
@@ -57,6 +58,8 @@ extern uint32_t __STACK_TOP;
 //*****************************************************************************
 
 extern void symbolTimerIsr(void);
+extern void uart0Isr(void);
+extern void pendSvIsr(void);
 // extern void triggerIsr(void);
 // extern void watchDogIsr(void);
 
@@ -85,14 +88,14 @@ void (* const g_pfnVectors[])(void) =
     IntDefaultHandler,                      // SVCall handler
     IntDefaultHandler,                      // Debug monitor handler
     0,                                      // Reserved
-    IntDefaultHandler,                      // The PendSV handler
+    pendSvIsr,                              // The PendSV handler (modified)
     IntDefaultHandler,                      // The SysTick handler
     IntDefaultHandler,                      // GPIO Port A
     IntDefaultHandler,                      // GPIO Port B
     IntDefaultHandler,                      // GPIO Port C
     IntDefaultHandler,                      // GPIO Port D
     IntDefaultHandler,                      // GPIO Port E
-    IntDefaultHandler,                      // UART0 Rx and Tx
+    uart0Isr,                               // UART0 Rx and Tx (modified)
     IntDefaultHandler,                      // UART1 Rx and Tx
     IntDefaultHandler,                      // SSI0 Rx and Tx
     IntDefaultHandler,                      // I2C0 Master and Slave
@@ -243,6 +246,12 @@ void (* const g_pfnVectors[])(void) =
 void
 ResetISR(void)
 {
+    //
+    // Start the cycle counter first so the boot time is counted from reset
+    // (modified).
+    //
+    initCycleCounter();
+
     //
     // Jump to the CCS C initialization routine.  This will enable the
     // floating-point unit as well, so that does not need to be done here.
@@ -14,11 +14,20 @@
 #include <tm4c123gh6pm.h>
 #include "inc/uart0.h"
 #include "inc/gpio.h"
+#include "inc/load.h"
 
 // Pins
 #define UART_TX PORTA,1
 #define UART_RX PORTA,0
 
+// Receive ring filled by uart0Isr once enabled, so input arriving while
+// the main loop is busy is not lost behind the 16 byte FIFO
+#define RX_SIZE 64
+
+static volatile char rxRing[RX_SIZE];
+static volatile uint8_t rxWrite = 0;
+static uint8_t rxRead = 0;
+static bool rxInterrupt = false;
 
 // Initialize UART0
 void initUart0(void)
@@ -71,6 +80,14 @@ void putsUart0(char* str)
 // Blocking function that returns with serial data once the buffer is not empty
 char getcUart0(void)
 {
+    char c;
+    if (rxInterrupt)
+    {
+        while (rxRead == rxWrite);                   // wait if rx ring empty
+        c = rxRing[rxRead];
+        rxRead = (rxRead + 1) % RX_SIZE;
+        return c;
+    }
     while (UART0_FR_R & UART_FR_RXFE);               // wait if uart0 rx fifo empty
     return UART0_DR_R & 0xFF;                        // get character from fifo
 }
@@ -78,5 +95,39 @@ char getcUart0(void)
 // Returns the status of the receive buffer
 bool kbhitUart0(void)
 {
+    if (rxInterrupt)
+        return rxRead != rxWrite;
     return !(UART0_FR_R & UART_FR_RXFE);
 }
+
+// Receive through the ring, interrupting at half FIFO or on receive
+// timeout; the caller enables the NVIC vector at its chosen priority
+void enableUart0RxInterrupt(void)
+{
+    rxRead = rxWrite = 0;
+    UART0_IFLS_R = (UART0_IFLS_R & ~UART_IFLS_RX_M) | UART_IFLS_RX4_8;
+    UART0_ICR_R = UART_ICR_RXIC | UART_ICR_RTIC;
+    UART0_IM_R |= UART_IM_RXIM | UART_IM_RTIM;
+    rxInterrupt = true;
+}
+
+// Drains the FIFO into the ring, bytes are dropped when it is full
+void uart0Isr(void)
+{
+    LOAD_MARK mark;
+    uint8_t next;
+    beginLoad(&mark);
+    UART0_ICR_R = UART_ICR_RXIC | UART_ICR_RTIC;
+    while (!(UART0_FR_R & UART_FR_RXFE))
+    {
+        next = (rxWrite + 1) % RX_SIZE;
+        if (next == rxRead)
+            UART0_DR_R;
+        else
+        {
+            rxRing[rxWrite] = UART0_DR_R & 0xFF;
+            rxWrite = next;
+        }
+    }
+    endLoad(&mark, LOAD_UART);
+}
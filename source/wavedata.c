@@ -0,0 +1,549 @@
+// Flash Waveform Library data
+
+// Generated by tools/wavenc.c, do not edit
+
+
+#include <stdint.h>
+#include "inc/flashwave.h"
+
+// chirp: 4096 I/Q pairs
+static const uint8_t wave0[] =
+{
+    0xC0, 0x76, 0x23, 0x80, 0x01, 0x28, 0x00, 0x48, 0x48, 0x38, 0x48, 0x39, 0x38, 0x4A, 0x3A, 0x4A,
+    0x3B, 0x3C, 0x4B, 0x3C, 0x4C, 0x3C, 0x3B, 0x4C, 0x3B, 0x3D, 0x4B, 0x3B, 0x4C, 0x3C, 0x3B, 0x3C,
+    0x5C, 0x2A, 0x3C, 0x4B, 0x2B, 0x4C, 0x2C, 0x3B, 0x3B, 0x3C, 0x4B, 0x3C, 0x3C, 0x3B, 0x4B, 0x3C,
+    0x4B, 0x3C, 0x3B, 0x3C, 0x3B, 0x4B, 0x3C, 0x3C, 0x4A, 0x3C, 0x2A, 0x3C, 0x4A, 0x2B, 0x3B, 0x2C,
+    0x3B, 0x2C, 0x3B, 0x3B, 0x2C, 0x2B, 0x3C, 0x1B, 0x1B, 0x1C, 0x8B, 0x8B, 0xBC, 0xBB, 0xDB, 0xDC,
+    0xBB, 0xDC, 0xCB, 0xCB, 0xBB, 0xCC, 0xCB, 0xBB, 0xCC, 0xBB, 0xCB, 0xCC, 0xBA, 0xCB, 0xBC, 0xCA,
+    0xBB, 0xCB, 0xBB, 0xCB, 0xBB, 0xBC, 0xCB, 0xCA, 0xBB, 0xBB, 0xCB, 0xBB, 0xBA, 0xCA, 0xCB, 0xA9,
+    0xB9, 0xC8, 0xB0, 0xB1, 0xB2, 0xC4, 0xB4, 0xB5, 0xC3, 0xB5, 0xC4, 0xA3, 0xB4, 0xB4, 0xC3, 0xB4,
+    0xA4, 0xC3, 0xA3, 0xA4, 0xB4, 0xB3, 0xA4, 0xB3, 0xB3, 0xB4, 0xB4, 0xA2, 0xB4, 0xA2, 0x93, 0xA4,
+    0x83, 0x03, 0x03, 0x24, 0x43, 0x43, 0x44, 0x43, 0x53, 0x34, 0x33, 0x53, 0x43, 0x33, 0x34, 0x53,
+    0x33, 0x42, 0x33, 0x33, 0x53, 0x33, 0x33, 0x42, 0x32, 0x32, 0x41, 0x38, 0x48, 0x39, 0x3B, 0x4D,
+    0x3C, 0x3C, 0x3C, 0x4C, 0x2B, 0x4D, 0x2B, 0x2C, 0x3B, 0x2C, 0x3C, 0x2B, 0x3B, 0x2C, 0x2B, 0x2C,
+    0x2B, 0x1C, 0x0B, 0x8B, 0x8C, 0xAB, 0xCB, 0xBB, 0xEC, 0xBB, 0xDC, 0xBA, 0xCB, 0xCA, 0xBB, 0xCB,
+    0xCB, 0xBB, 0xBB, 0xCA, 0xBB, 0xC9, 0xBA, 0xC8, 0xB8, 0xB0, 0xC2, 0xB3, 0xB6, 0xB3, 0xC5, 0xB4,
+    0xB3, 0xB5, 0xB3, 0xB4, 0xB3, 0xC4, 0xA3, 0xA4, 0xA3, 0x94, 0x93, 0x84, 0x03, 0x13, 0x23, 0x34,
+    0x53, 0x44, 0x42, 0x33, 0x52, 0x33, 0x53, 0x33, 0x32, 0x43, 0x42, 0x32, 0x31, 0x40, 0x30, 0x38,
+    0x4A, 0x3C, 0x3B, 0x4E, 0x2B, 0x3D, 0x70, 0x56, 0x38, 0x70, 0x51, 0x33, 0x00, 0x7E, 0x4B, 0x2B,
+    0x2D, 0x2B, 0x1B, 0x1C, 0x1B, 0x0C, 0x9B, 0x9B, 0xAC, 0xCB, 0xCA, 0xDC, 0xBA, 0xCA, 0xCB, 0xBA,
+    0xCA, 0xBA, 0xCA, 0xC9, 0xA9, 0xC8, 0xA0, 0xB1, 0xB2, 0xB3, 0xC6, 0xA4, 0xB3, 0xB4, 0xB4, 0xB4,
+    0xA3, 0xA3, 0xA5, 0x93, 0x93, 0x04, 0x03, 0x23, 0x43, 0x34, 0x63, 0x33, 0x53, 0x33, 0x43, 0x42,
+    0x33, 0x41, 0x32, 0x30, 0x40, 0x39, 0x3B, 0x4C, 0x3C, 0x3D, 0x3B, 0x3D, 0x3B, 0x2C, 0x3C, 0x2B,
+    0x1B, 0x1C, 0x8B, 0x8C, 0xAB, 0xCB, 0xCB, 0xCC, 0xCA, 0xCB, 0xCA, 0xBA, 0xBA, 0xDA, 0xB9, 0xB8,
+    0xC0, 0xB1, 0xB2, 0xC3, 0xA6, 0xB3, 0xB5, 0xB3, 0xA5, 0xA3, 0xA3, 0x95, 0x93, 0x03, 0x03, 0x24,
+    0x43, 0x43, 0x43, 0x43, 0x33, 0x53, 0x33, 0x42, 0x31, 0x41, 0x38, 0x39, 0x3B, 0x4C, 0x3D, 0x3C,
+    0x2C, 0x3B, 0x3D, 0x1B, 0x2C, 0x1B, 0x8B, 0x8C, 0xAB, 0xBB, 0xEB, 0xBB, 0xDC, 0xCA, 0xBA, 0xCA,
+    0xB9, 0xC9, 0xB0, 0xB0, 0xC1, 0xB3, 0xB5, 0xB3, 0xB5, 0xB4, 0xB3, 0xA4, 0x94, 0x93, 0x03, 0x03,
+    0x34, 0x43, 0x53, 0x33, 0x53, 0x43, 0x32, 0x42, 0x31, 0x40, 0x38, 0x3A, 0x4C, 0x2C, 0x3C, 0x2C,
+    0x3B, 0x2D, 0x1B, 0x1C, 0x0B, 0x8B, 0x9C, 0xBB, 0xCB, 0xDB, 0xBB, 0xDA, 0xBB, 0xD9, 0xA9, 0xC8,
+    0xA0, 0xB2, 0xB3, 0xB5, 0xB5, 0xB3, 0xA5, 0xA3, 0xA4, 0x83, 0x84, 0x13, 0x23, 0x43, 0x53, 0x43,
+    0x33, 0x43, 0x42, 0x31, 0x40, 0x39, 0x3A, 0x4B, 0x2E, 0x3C, 0x2C, 0x2B, 0x1C, 0x1C, 0x0B, 0x8B,
+    0x9C, 0xAB, 0xCB, 0xDB, 0xBA, 0xDB, 0xB9, 0xB9, 0xD9, 0xB0, 0xB2, 0xB3, 0xB5, 0xB4, 0xB4, 0xB3,
+    0xA5, 0x93, 0x84, 0x12, 0x14, 0x42, 0x52, 0x32, 0x52, 0x32, 0x51, 0x31, 0x38, 0x38, 0x4A, 0x3B,
+    0x3D, 0x2C, 0x3C, 0x1B, 0x1C, 0x0B, 0x8C, 0x9B, 0xBB, 0xEB, 0xBB, 0xDA, 0x00, 0x92, 0x38, 0xC0,
+    0x2C, 0x3F, 0x00, 0xFC, 0xB9, 0xB0, 0xC2, 0xB6, 0xB4, 0xA5, 0xB3, 0xA5, 0x93, 0x94, 0x03, 0x13,
+    0x24, 0x53, 0x32, 0x52, 0x42, 0x31, 0x41, 0x38, 0x49, 0x2A, 0x3C, 0x2C, 0x3C, 0x1C, 0x2B, 0x0C,
+    0x8B, 0x9C, 0xAB, 0xDA, 0xCB, 0xBA, 0xD9, 0xB9, 0xB8, 0xC0, 0xB1, 0xC3, 0xA5, 0xA4, 0xA4, 0x93,
+    0x84, 0x83, 0x14, 0x13, 0x43, 0x32, 0x53, 0x41, 0x31, 0x41, 0x38, 0x3A, 0x3B, 0x3D, 0x3C, 0x3C,
+    0x2C, 0x0B, 0x0B, 0xAC, 0xBB, 0xDA, 0xCB, 0xCA, 0xCA, 0xB8, 0xC8, 0xB1, 0xC2, 0xA4, 0xA4, 0xA4,
+    0x94, 0x93, 0x84, 0x03, 0x24, 0x32, 0x52, 0x42, 0x32, 0x41, 0x48, 0x38, 0x3A, 0x3B, 0x3C, 0x2D,
+    0x2C, 0x1B, 0x0B, 0x9C, 0xAB, 0xCB, 0xDB, 0xBB, 0xD9, 0xB9, 0xC8, 0xB1, 0xB2, 0xB5, 0xA4, 0xB4,
+    0x93, 0x94, 0x03, 0x14, 0x33, 0x52, 0x43, 0x41, 0x41, 0x30, 0x38, 0x49, 0x2B, 0x3E, 0x2B, 0x1C,
+    0x1C, 0x8B, 0x8B, 0xBC, 0xBA, 0xEA, 0xCA, 0xB9, 0xC8, 0xB0, 0xB1, 0xB3, 0xC5, 0x94, 0xA3, 0x84,
+    0x84, 0x13, 0x22, 0x43, 0x42, 0x42, 0x31, 0x40, 0x38, 0x4A, 0x2C, 0x2C, 0x2D, 0x1B, 0x0B, 0x8C,
+    0xAB, 0xBB, 0xCB, 0xDA, 0xBA, 0xC8, 0xB0, 0xC1, 0xA3, 0xB6, 0xA3, 0x95, 0x83, 0x04, 0x13, 0x23,
+    0x42, 0x53, 0x31, 0x41, 0x38, 0x49, 0x3B, 0x2D, 0x2C, 0x1C, 0x1B, 0x8C, 0x9B, 0xAB, 0xDA, 0xCB,
+    0xB9, 0xC9, 0xC0, 0xA2, 0xB3, 0xA5, 0xA4, 0x94, 0x94, 0x02, 0x23, 0x33, 0x53, 0x42, 0x41, 0x30,
+    0x39, 0x4A, 0x2B, 0x2E, 0x2C, 0x1B, 0x8C, 0x8B, 0xBB, 0xCB, 0xCB, 0xC9, 0xB9, 0xC0, 0xB1, 0xB4,
+    0xB4, 0xA4, 0x94, 0x83, 0x03, 0x24, 0x53, 0x32, 0x51, 0x41, 0x38, 0x39, 0x3B, 0x3C, 0x2D, 0x1B,
+    0x0C, 0x8B, 0xBC, 0xCA, 0xCA, 0xD9, 0xB9, 0xC0, 0xB1, 0xA3, 0xB4, 0xA4, 0x94, 0x83, 0x14, 0x23,
+    0x52, 0x32, 0x60, 0x72, 0x2E, 0x20, 0xE0, 0x47, 0x00, 0x47, 0x4A, 0x3F, 0x2F, 0x3D, 0x1B, 0x1C,
+    0x8B, 0x9C, 0xBB, 0xDA, 0xCA, 0xC8, 0xB8, 0xB1, 0xB2, 0xB4, 0xB4, 0x94, 0x84, 0x02, 0x33, 0x53,
+    0x42, 0x41, 0x30, 0x48, 0x3A, 0x3C, 0x2C, 0x1C, 0x1B, 0x8C, 0xAB, 0xCB, 0xCA, 0xCA, 0xB8, 0xC0,
+    0xB2, 0xB4, 0xA4, 0xA4, 0x83, 0x04, 0x13, 0x43, 0x42, 0x42, 0x30, 0x48, 0x3A, 0x3B, 0x3E, 0x1C,
+    0x0B, 0x8B, 0xAC, 0xBB, 0xEA, 0xC9, 0xB8, 0xC0, 0xA2, 0xB4, 0xA4, 0x94, 0x83, 0x14, 0x22, 0x43,
+    0x41, 0x41, 0x30, 0x49, 0x2A, 0x3C, 0x1D, 0x1B, 0x8C, 0x9A, 0xBB, 0xCB, 0xD9, 0xB9, 0xC0, 0xB2,
+    0xA4, 0xA4, 0xA4, 0x83, 0x14, 0x23, 0x42, 0x52, 0x31, 0x48, 0x39, 0x2B, 0x3C, 0x2D, 0x0B, 0x8C,
+    0xAB, 0xCB, 0xCA, 0xC9, 0xB8, 0xC1, 0xB3, 0xA4, 0xA5, 0x83, 0x84, 0x23, 0x33, 0x52, 0x41, 0x30,
+    0x48, 0x3B, 0x3C, 0x1D, 0x1B, 0x8C, 0x9B, 0xBB, 0xEA, 0xB9, 0xC8, 0xB0, 0xB3, 0xB4, 0xA5, 0x83,
+    0x84, 0x23, 0x43, 0x42, 0x51, 0x30, 0x39, 0x3B, 0x2C, 0x2D, 0x0C, 0x8B, 0xAB, 0xDA, 0xCA, 0xB9,
+    0xC0, 0xB1, 0xB4, 0xA4, 0xA4, 0x03, 0x03, 0x34, 0x52, 0x41, 0x40, 0x38, 0x3A, 0x2B, 0x2E, 0x1B,
+    0x8C, 0xAB, 0xCA, 0xCA, 0xC9, 0xB0, 0xC1, 0xA3, 0xA5, 0x94, 0x83, 0x14, 0x22, 0x53, 0x31, 0x40,
+    0x49, 0x2A, 0x2C, 0x1C, 0x0C, 0x8B, 0xAB, 0xBB, 0xD9, 0xC9, 0xB0, 0xB3, 0xB4, 0xA4, 0x84, 0x04,
+    0x22, 0x43, 0x41, 0x41, 0x48, 0x2A, 0x3B, 0x1D, 0x1C, 0x8B, 0x9B, 0xBB, 0xDA, 0xC9, 0xB0, 0xB2,
+    0xB4, 0xB4, 0x84, 0x84, 0x22, 0x43, 0x51, 0x31, 0x48, 0x39, 0x3C, 0x1B, 0x1D, 0x8B, 0xAB, 0xBB,
+    0xEA, 0xB9, 0xD0, 0xA2, 0xA5, 0x94, 0x93, 0x14, 0x13, 0x42, 0x32, 0x50, 0x38, 0x2B, 0x3C, 0x1D,
+    0x0B, 0x9B, 0xAC, 0xDA, 0xC9, 0xB0, 0xB0, 0xC3, 0x10, 0xCA, 0x47, 0x30, 0x96, 0x3F, 0x00, 0xC5,
+    0x84, 0x43, 0x73, 0x42, 0x31, 0x48, 0x3A, 0x3C, 0x2D, 0x0B, 0x9C, 0xAA, 0xDA, 0xBA, 0xD8, 0xB1,
+    0xB3, 0xA4, 0x95, 0x03, 0x13, 0x43, 0x42, 0x30, 0x58, 0x2A, 0x2C, 0x1D, 0x0B, 0x8C, 0xAB, 0xC9,
+    0xC9, 0xC8, 0xA1, 0xA3, 0xA5, 0x94, 0x03, 0x23, 0x42, 0x42, 0x30, 0x49, 0x2B, 0x2D, 0x1C, 0x0B,
+    0xAC, 0xBA, 0xDA, 0xC8, 0xB0, 0xB3, 0xA4, 0xA4, 0x03, 0x14, 0x42, 0x42, 0x40, 0x38, 0x3A, 0x2C,
+    0x2C, 0x8B, 0x9C, 0xBA, 0xEA, 0xB9, 0xC0, 0xB2, 0xA4, 0x94, 0x84, 0x12, 0x33, 0x52, 0x40, 0x38,
+    0x3A, 0x3C, 0x1C, 0x0C, 0xAA, 0xBB, 0xE9, 0xC9, 0xB0, 0xA3, 0xA4, 0x94, 0x84, 0x22, 0x33, 0x51,
+    0x40, 0x38, 0x3B, 0x3C, 0x0D, 0x0B, 0xBB, 0xCA, 0xD9, 0xB8, 0xB1, 0xC4, 0x94, 0x83, 0x04, 0x23,
+    0x42, 0x41, 0x38, 0x4A, 0x2B, 0x1E, 0x8B, 0x8C, 0xBA, 0xDA, 0xB8, 0xC1, 0xA2, 0xA4, 0x94, 0x03,
+    0x23, 0x43, 0x42, 0x38, 0x39, 0x4C, 0x1D, 0x0B, 0x9C, 0xAA, 0xCA, 0xD8, 0xA0, 0xB2, 0xA4, 0x94,
+    0x03, 0x24, 0x42, 0x41, 0x38, 0x49, 0x2B, 0x1D, 0x0B, 0x9C, 0xBA, 0xCA, 0xC8, 0xC1, 0xA2, 0x94,
+    0x94, 0x04, 0x22, 0x42, 0x40, 0x30, 0x3A, 0x2C, 0x2B, 0x8D, 0xAA, 0xCA, 0xD9, 0xB8, 0xB1, 0xB3,
+    0x95, 0x84, 0x12, 0x43, 0x41, 0x40, 0x39, 0x3B, 0x1C, 0x1C, 0x9C, 0xBA, 0xDA, 0xC8, 0xB1, 0xB2,
+    0xA4, 0x94, 0x13, 0x33, 0x42, 0x51, 0x39, 0x3A, 0x2D, 0x1C, 0x8B, 0xBB, 0xCA, 0xD9, 0xB0, 0xB2,
+    0xB5, 0x84, 0x03, 0x23, 0x53, 0x40, 0x38, 0x3A, 0x3D, 0x0C, 0x8B, 0xAB, 0xDB, 0xC8, 0xB0, 0xB3,
+    0xB4, 0x85, 0x03, 0x33, 0x53, 0x40, 0x38, 0x3B, 0x2D, 0x1C, 0x9B, 0xBB, 0xDA, 0xC9, 0xB1, 0xB3,
+    0xA5, 0x84, 0x04, 0x42, 0x41, 0x30, 0x49, 0x3B, 0x1C, 0x0B, 0x9C, 0xBB, 0xE9, 0xB0, 0x10, 0x9D,
+    0x48, 0x50, 0xBE, 0x4C, 0x00, 0xC4, 0x96, 0x03, 0x23, 0x32, 0x61, 0x38, 0x3A, 0x2C, 0x1D, 0x9B,
+    0xAB, 0xDA, 0xC8, 0xB1, 0xA2, 0xA5, 0x84, 0x13, 0x32, 0x52, 0x40, 0x3A, 0x2B, 0x1E, 0x0B, 0xAB,
+    0xCA, 0xC9, 0xC0, 0xA2, 0xA5, 0x84, 0x13, 0x23, 0x41, 0x40, 0x39, 0x2B, 0x2D, 0x8C, 0x9B, 0xCA,
+    0xC9, 0xC0, 0xA2, 0xA4, 0x84, 0x04, 0x22, 0x41, 0x40, 0x39, 0x3A, 0x1D, 0x0B, 0xAB, 0xCB, 0xC9,
+    0xC1, 0xA2, 0xA5, 0x84, 0x13, 0x23, 0x41, 0x40, 0x3A, 0x3B, 0x1E, 0x8B, 0xBB, 0xCA, 0xC9, 0xC1,
+    0xA3, 0x95, 0x84, 0x13, 0x32, 0x52, 0x38, 0x3B, 0x2C, 0x1C, 0x9C, 0xBA, 0xE9, 0xB8, 0xB1, 0xB4,
+    0x93, 0x04, 0x33, 0x52, 0x40, 0x39, 0x3C, 0x1B, 0x8D, 0x9B, 0xD9, 0xB9, 0xC1, 0xB2, 0x95, 0x83,
+    0x13, 0x43, 0x41, 0x38, 0x3B, 0x2D, 0x0C, 0x9B, 0xCB, 0xC9, 0xC0, 0xA2, 0xA5, 0x83, 0x04, 0x33,
+    0x51, 0x38, 0x4A, 0x1C, 0x1C, 0x9B, 0xAB, 0xD9, 0xB8, 0xB2, 0xA5, 0x83, 0x04, 0x33, 0x51, 0x40,
+    0x3A, 0x2C, 0x0C, 0x8B, 0xBB, 0xDA, 0xB0, 0xC2, 0x94, 0x95, 0x13, 0x22, 0x42, 0x48, 0x3A, 0x2C,
+    0x0C, 0x9B, 0xBB, 0xC9, 0xC8, 0xB2, 0xA5, 0x94, 0x13, 0x42, 0x41, 0x38, 0x3A, 0x3C, 0x0C, 0xAC,
+    0xC9, 0xC9, 0xC0, 0xB2, 0x94, 0x83, 0x24, 0x32, 0x50, 0x48, 0x2B, 0x1C, 0x8C, 0x9B, 0xCA, 0xB8,
+    0xC1, 0xA4, 0x93, 0x05, 0x22, 0x41, 0x40, 0x39, 0x2C, 0x1B, 0x9C, 0xBA, 0xD9, 0xC0, 0xA2, 0xA4,
+    0x04, 0x13, 0x32, 0x50, 0x38, 0x3B, 0x1D, 0x8C, 0xAA, 0xDA, 0xB8, 0xC2, 0xA3, 0x94, 0x14, 0x23,
+    0x51, 0x38, 0x3A, 0x2C, 0x0C, 0x9B, 0xCA, 0xD9, 0xB1, 0xA3, 0x95, 0x04, 0x22, 0x41, 0x40, 0x39,
+    0x2C, 0x1B, 0x9C, 0xBA, 0xE9, 0xB0, 0xA2, 0xA5, 0x03, 0x23, 0x42, 0x41, 0x3A, 0x2C, 0x1C, 0x9C,
+    0xBA, 0xD9, 0xC0, 0xA2, 0x90, 0xE3, 0x54, 0xB0, 0x8C, 0x43, 0x00, 0x82, 0x72, 0x62, 0x38, 0x49,
+    0x2A, 0x1D, 0x9B, 0xBA, 0xD9, 0xB0, 0xB3, 0xA4, 0x04, 0x33, 0x42, 0x50, 0x3A, 0x1C, 0x1C, 0x9B,
+    0xCB, 0xB8, 0xC0, 0xB3, 0x96, 0x03, 0x32, 0x52, 0x38, 0x3A, 0x2C, 0x0C, 0xAB, 0xCA, 0xD9, 0xB2,
+    0xA3, 0x86, 0x03, 0x42, 0x31, 0x48, 0x3B, 0x1D, 0x8B, 0xAB, 0xDA, 0xC0, 0xA2, 0x95, 0x84, 0x13,
+    0x41, 0x30, 0x49, 0x2C, 0x0B, 0x9C, 0xBB, 0xD8, 0xB1, 0xA3, 0x95, 0x13, 0x23, 0x51, 0x48, 0x2B,
+    0x1D, 0x8C, 0xAB, 0xC9, 0xB0, 0xC2, 0x94, 0x84, 0x23, 0x41, 0x30, 0x4A, 0x1B, 0x0E, 0x9A, 0xBA,
+    0xD8, 0xB1, 0xA3, 0x85, 0x13, 0x32, 0x50, 0x48, 0x2C, 0x0C, 0x9B, 0xAA, 0xC9, 0xC1, 0xA3, 0x85,
+    0x03, 0x23, 0x41, 0x48, 0x2B, 0x1E, 0x8B, 0xBB, 0xC9, 0xB0, 0xB3, 0xA5, 0x04, 0x32, 0x61, 0x38,
+    0x3A, 0x1C, 0x8C, 0xAA, 0xD9, 0xC0, 0xA2, 0x94, 0x03, 0x24, 0x41, 0x38, 0x4A, 0x1C, 0x8C, 0xAA,
+    0xC9, 0xC0, 0xA2, 0x94, 0x03, 0x24, 0x41, 0x38, 0x4A, 0x1D, 0x8B, 0xAA, 0xD9, 0xB0, 0xA2, 0x95,
+    0x03, 0x33, 0x41, 0x48, 0x3B, 0x0D, 0x8C, 0xBA, 0xC9, 0xC1, 0xB2, 0x85, 0x03, 0x32, 0x50, 0x38,
+    0x3B, 0x0D, 0x9B, 0xBB, 0xE8, 0xB1, 0xA4, 0x84, 0x23, 0x32, 0x50, 0x3A, 0x2C, 0x0C, 0xAB, 0xCA,
+    0xC0, 0xB2, 0xA4, 0x04, 0x23, 0x52, 0x38, 0x3B, 0x2D, 0x9B, 0xBB, 0xD9, 0xC0, 0xA4, 0x84, 0x03,
+    0x33, 0x40, 0x49, 0x2C, 0x0C, 0x9B, 0xBA, 0xD8, 0xB2, 0x94, 0x84, 0x23, 0x42, 0x48, 0x2B, 0x1C,
+    0x8C, 0xAB, 0xD9, 0xB1, 0xA3, 0x95, 0x13, 0x42, 0x31, 0x4A, 0x2C, 0x0C, 0x9B, 0xCA, 0xC0, 0xB2,
+    0x95, 0x03, 0x23, 0x51, 0x38, 0x2B, 0x1E, 0x9B, 0xBA, 0xE8, 0xA1, 0xA3, 0x86, 0x22, 0x32, 0x58,
+    0x3A, 0x1C, 0x8B, 0xBB, 0xC9, 0xC1, 0xA3, 0x96, 0x23, 0x32, 0xB0, 0x74, 0x52, 0x10, 0x16, 0x4C,
+    0x00, 0x5A, 0x2B, 0x0D, 0xBA, 0xE9, 0xB0, 0xA3, 0x94, 0x03, 0x43, 0x40, 0x3A, 0x2C, 0x8C, 0xAB,
+    0xCA, 0xC0, 0xA3, 0x95, 0x03, 0x33, 0x51, 0x3A, 0x2C, 0x0C, 0xAB, 0xCA, 0xC0, 0xB2, 0x95, 0x14,
+    0x32, 0x50, 0x39, 0x2B, 0x8C, 0x9B, 0xDA, 0xB0, 0xB3, 0x95, 0x13, 0x33, 0x60, 0x29, 0x2D, 0x0B,
+    0xAC, 0xC9, 0xC0, 0xA3, 0x84, 0x03, 0x33, 0x50, 0x2A, 0x2D, 0x8C, 0xAA, 0xC9, 0xC1, 0xA2, 0x85,
+    0x13, 0x41, 0x30, 0x3A, 0x1C, 0x8C, 0xBA, 0xE8, 0xB1, 0x93, 0x84, 0x23, 0x42, 0x38, 0x3C, 0x1C,
+    0x9B, 0xCA, 0xD8, 0xA2, 0xA5, 0x03, 0x33, 0x41, 0x49, 0x1C, 0x0C, 0x9B, 0xCA, 0xB1, 0xB2, 0x95,
+    0x23, 0x42, 0x40, 0x3A, 0x1C, 0x8C, 0xBB, 0xD8, 0xB1, 0xA4, 0x83, 0x24, 0x51, 0x38, 0x3B, 0x0D,
+    0x9B, 0xD9, 0xB0, 0xB2, 0x94, 0x14, 0x32, 0x68, 0x39, 0x1C, 0x8B, 0xBB, 0xC8, 0xC1, 0x94, 0x84,
+    0x23, 0x41, 0x39, 0x3B, 0x0D, 0xAB, 0xCA, 0xC0, 0xB3, 0x95, 0x13, 0x42, 0x40, 0x2A, 0x2D, 0x9B,
+    0xBB, 0xC8, 0xC2, 0x94, 0x05, 0x22, 0x40, 0x39, 0x2B, 0x0C, 0xBB, 0xC9, 0xC1, 0xA3, 0x86, 0x12,
+    0x51, 0x38, 0x2A, 0x0D, 0x9A, 0xCA, 0xC0, 0xA3, 0x94, 0x13, 0x42, 0x38, 0x3A, 0x2D, 0xAC, 0xC9,
+    0xC8, 0xB2, 0x93, 0x15, 0x31, 0x50, 0x39, 0x2C, 0x9B, 0xBA, 0xD8, 0xB2, 0xA4, 0x04, 0x42, 0x30,
+    0x49, 0x2C, 0x8B, 0xBB, 0xD9, 0xB2, 0x94, 0x04, 0x23, 0x51, 0x3A, 0x2C, 0x8C, 0xBA, 0xD9, 0xB1,
+    0x94, 0x84, 0x32, 0x50, 0x39, 0x1B, 0x0C, 0xBB, 0xC9, 0xC2, 0xA4, 0x04, 0x22, 0x51, 0x29, 0x2C,
+    0x8C, 0xAA, 0xC8, 0xC1, 0x93, 0x04, 0x23, 0x41, 0x3A, 0x1C, 0x0C, 0xBA, 0xD9, 0xB2, 0xA4, 0x13,
+    0x23, 0x50, 0x3A, 0x1C, 0x8D, 0xBA, 0xD8, 0xB2, 0x94, 0x13, 0x32, 0x50, 0x3A, 0x1D, 0x9B, 0xCA,
+    0xA0, 0x8E, 0x45, 0xC0, 0xDC, 0x4C, 0x00, 0xF7, 0x87, 0x03, 0x41, 0x30, 0x3B, 0x0C, 0x9B, 0xDA,
+    0xB0, 0xA3, 0x96, 0x22, 0x52, 0x39, 0x2B, 0x0C, 0xAB, 0xD9, 0xB1, 0xA3, 0x06, 0x22, 0x51, 0x39,
+    0x2C, 0x8B, 0xBB, 0xD8, 0xB2, 0x95, 0x03, 0x42, 0x30, 0x4A, 0x0D, 0x9B, 0xBA, 0xC0, 0xB3, 0x84,
+    0x14, 0x51, 0x38, 0x3B, 0x8D, 0xAA, 0xD9, 0xB1, 0xA3, 0x05, 0x32, 0x50, 0x39, 0x1C, 0x8B, 0xCA,
+    0xC8, 0xA2, 0x95, 0x13, 0x42, 0x38, 0x3B, 0x0D, 0xAB, 0xD9, 0xB1, 0xA3, 0x06, 0x22, 0x50, 0x39,
+    0x2C, 0x9B, 0xBA, 0xE0, 0xA2, 0x85, 0x12, 0x32, 0x48, 0x2B, 0x0D, 0xAA, 0xD9, 0xB1, 0x93, 0x05,
+    0x32, 0x40, 0x4A, 0x0C, 0x8B, 0xBA, 0xD0, 0xA3, 0x85, 0x23, 0x31, 0x49, 0x2B, 0x8E, 0xAA, 0xD8,
+    0xB2, 0x93, 0x14, 0x42, 0x38, 0x3B, 0x0C, 0xAB, 0xDA, 0xB1, 0xA5, 0x03, 0x33, 0x50, 0x3A, 0x1D,
+    0x9B, 0xCA, 0xC0, 0xA3, 0x85, 0x23, 0x41, 0x39, 0x2D, 0x8B, 0xCA, 0xC8, 0xA3, 0x95, 0x23, 0x41,
+    0x39, 0x2B, 0x0D, 0xBA, 0xE8, 0xA1, 0x94, 0x13, 0x32, 0x48, 0x2B, 0x0D, 0xAB, 0xD9, 0xB2, 0x94,
+    0x14, 0x32, 0x58, 0x2A, 0x0D, 0x9A, 0xD9, 0xA1, 0xA3, 0x04, 0x33, 0x48, 0x3A, 0x1D, 0xAB, 0xC9,
+    0xC1, 0xA3, 0x05, 0x32, 0x40, 0x3A, 0x1C, 0xAB, 0xCA, 0xC1, 0xA4, 0x04, 0x32, 0x40, 0x3A, 0x1C,
+    0xAB, 0xCA, 0xC1, 0xA3, 0x06, 0x32, 0x40, 0x3A, 0x1C, 0xAB, 0xC9, 0xC1, 0xA3, 0x05, 0x32, 0x40,
+    0x3A, 0x1C, 0xAB, 0xCA, 0xC1, 0xA4, 0x04, 0x32, 0x50, 0x2A, 0x0D, 0x9A, 0xC9, 0xB1, 0xA3, 0x14,
+    0x32, 0x50, 0x2B, 0x0D, 0xAB, 0xC8, 0xB1, 0x94, 0x04, 0x51, 0x38, 0x2B, 0x0C, 0xBA, 0xD8, 0xB2,
+    0x84, 0x13, 0x42, 0x39, 0x3C, 0x9C, 0xBA, 0xE8, 0xA3, 0x84, 0x23, 0x31, 0x59, 0x1D, 0x9B, 0xBA,
+    0xC0, 0xA4, 0x03, 0x23, 0x50, 0x2A, 0xE0, 0xF3, 0x4E, 0x20, 0x76, 0x46, 0x00, 0xFF, 0xE9, 0xC1,
+    0x93, 0x04, 0x32, 0x48, 0x2B, 0x0C, 0xAB, 0xD8, 0xA2, 0x95, 0x13, 0x41, 0x39, 0x2C, 0x8B, 0xCB,
+    0xC0, 0xA4, 0x04, 0x22, 0x41, 0x3A, 0x0D, 0x9B, 0xC9, 0xC1, 0x94, 0x03, 0x32, 0x48, 0x2B, 0x0D,
+    0xBA, 0xC9, 0xB3, 0x94, 0x23, 0x51, 0x39, 0x1D, 0x8B, 0xCA, 0xC1, 0xA3, 0x05, 0x33, 0x48, 0x2A,
+    0x1D, 0xBB, 0xC8, 0xB2, 0x94, 0x13, 0x51, 0x39, 0x2C, 0x9C, 0xC9, 0xB0, 0xB2, 0x05, 0x32, 0x68,
+    0x2A, 0x0B, 0xAC, 0xC8, 0xB1, 0x94, 0x23, 0x42, 0x49, 0x1D, 0x8B, 0xC9, 0xB0, 0xA3, 0x05, 0x32,
+    0x58, 0x2A, 0x0C, 0xAB, 0xC8, 0xB2, 0x95, 0x22, 0x51, 0x39, 0x1C, 0x9B, 0xCA, 0xC1, 0x94, 0x04,
+    0x31, 0x48, 0x2A, 0x8D, 0xBA, 0xC0, 0xA2, 0x84, 0x22, 0x50, 0x3A, 0x0C, 0xAB, 0xC8, 0xB2, 0x94,
+    0x14, 0x50, 0x38, 0x1C, 0x9B, 0xC9, 0xB0, 0xA4, 0x13, 0x42, 0x38, 0x3C, 0x8B, 0xCB, 0xC8, 0xB4,
+    0x05, 0x32, 0x58, 0x2A, 0x0C, 0xAA, 0xD8, 0xA2, 0x84, 0x13, 0x41, 0x3A, 0x1D, 0xAB, 0xC9, 0xB2,
+    0x94, 0x13, 0x41, 0x49, 0x1C, 0x9C, 0xB9, 0xC0, 0xA4, 0x13, 0x32, 0x59, 0x2B, 0x8D, 0xCA, 0xB0,
+    0xA3, 0x05, 0x31, 0x50, 0x2B, 0x0C, 0xBA, 0xD0, 0xA2, 0x05, 0x22, 0x48, 0x2A, 0x0C, 0xAA, 0xD8,
+    0xA2, 0x85, 0x22, 0x40, 0x3A, 0x0C, 0xAA, 0xD9, 0xA3, 0x84, 0x13, 0x40, 0x3A, 0x0D, 0xAB, 0xC8,
+    0xB2, 0x94, 0x33, 0x41, 0x4A, 0x0D, 0x9B, 0xC8, 0xB1, 0x95, 0x22, 0x51, 0x2A, 0x1C, 0xAA, 0xC9,
+    0xB2, 0x84, 0x23, 0x41, 0x3A, 0x1D, 0xAB, 0xD8, 0xB1, 0x85, 0x12, 0x51, 0x2A, 0x1C, 0xAA, 0xC9,
+    0xB2, 0x84, 0x23, 0x41, 0x3A, 0x1D, 0xAB, 0xD8, 0xB2, 0x84, 0x23, 0x40, 0x3A, 0x0D, 0xAB, 0xD8,
+    0xB3, 0x84, 0x33, 0x40, 0x3B, 0x0D, 0xBA, 0xD8, 0xA2, 0x85, 0x22, 0x50, 0x80, 0x2F, 0x51, 0xD0,
+    0x6C, 0x51, 0x00, 0x8E, 0xCA, 0xD8, 0xA3, 0x84, 0x32, 0x58, 0x2B, 0x8C, 0xBA, 0xC0, 0xA3, 0x06,
+    0x41, 0x38, 0x2B, 0x9B, 0xCA, 0xB0, 0xA5, 0x13, 0x42, 0x4A, 0x1C, 0x9B, 0xC9, 0xB1, 0x95, 0x23,
+    0x41, 0x4A, 0x0D, 0x9A, 0xC9, 0xB2, 0x85, 0x22, 0x50, 0x2A, 0x8C, 0xAA, 0xB8, 0xB3, 0x84, 0x42,
+    0x48, 0x2B, 0x8D, 0xB9, 0xD0, 0x93, 0x04, 0x41, 0x28, 0x2C, 0x9B, 0xC9, 0xB1, 0x94, 0x24, 0x40,
+    0x39, 0x1C, 0xBB, 0xD8, 0xB3, 0x04, 0x22, 0x50, 0x2B, 0x8D, 0xBA, 0xC0, 0xA4, 0x13, 0x31, 0x59,
+    0x1B, 0x9D, 0xB9, 0xC1, 0x94, 0x23, 0x40, 0x3A, 0x0C, 0xBB, 0xC0, 0xB2, 0x05, 0x32, 0x58, 0x2B,
+    0x8C, 0xCA, 0xB1, 0xA4, 0x13, 0x51, 0x39, 0x0D, 0x9A, 0xC9, 0xB2, 0x84, 0x23, 0x50, 0x2B, 0x0D,
+    0xBA, 0xD0, 0x93, 0x04, 0x32, 0x49, 0x1C, 0x9B, 0xC9, 0xB2, 0x84, 0x23, 0x41, 0x3B, 0x8E, 0xBA,
+    0xC0, 0xB3, 0x14, 0x41, 0x48, 0x1C, 0x9B, 0xC9, 0xB2, 0x84, 0x23, 0x40, 0x3B, 0x8C, 0xBB, 0xC0,
+    0xB4, 0x14, 0x41, 0x49, 0x1B, 0x9C, 0xC9, 0xB2, 0x84, 0x23, 0x50, 0x2B, 0x8D, 0xBA, 0xC0, 0x94,
+    0x13, 0x31, 0x49, 0x1D, 0xAA, 0xC8, 0xB2, 0x84, 0x32, 0x58, 0x2B, 0x8C, 0xCA, 0xB1, 0x94, 0x23,
+    0x41, 0x3A, 0x0D, 0xBA, 0xD8, 0xA3, 0x04, 0x32, 0x59, 0x1C, 0x9B, 0xC9, 0xA2, 0x85, 0x23, 0x48,
+    0x2B, 0x8C, 0xBA, 0xD1, 0x94, 0x13, 0x41, 0x2A, 0x0D, 0xAA, 0xC8, 0xA3, 0x04, 0x32, 0x59, 0x1C,
+    0x9B, 0xC9, 0xA2, 0x85, 0x23, 0x48, 0x2B, 0x8D, 0xC9, 0xB1, 0x93, 0x24, 0x40, 0x3A, 0x0C, 0xCA,
+    0xB0, 0xA3, 0x14, 0x42, 0x4A, 0x0C, 0xAB, 0xC8, 0xA3, 0x05, 0x32, 0x49, 0x2B, 0xAD, 0xC8, 0xB1,
+    0x84, 0x32, 0x58, 0x2A, 0x9C, 0xBA, 0xC1, 0x94, 0x23, 0x40, 0x3B, 0x8C, 0xBA, 0xD0, 0x95, 0x12,
+    0x41, 0x2A, 0x60, 0xD9, 0x51, 0x50, 0x70, 0x4B, 0x00, 0xFD, 0xE0, 0x94, 0x03, 0x32, 0x4A, 0x0D,
+    0xAB, 0xB0, 0xB3, 0x04, 0x42, 0x49, 0x1C, 0xAC, 0xC8, 0xA2, 0x84, 0x42, 0x39, 0x1B, 0x9C, 0xC8,
+    0xB2, 0x84, 0x32, 0x58, 0x2B, 0x9D, 0xC9, 0xB2, 0x83, 0x23, 0x50, 0x2C, 0x9C, 0xB9, 0xC1, 0x84,
+    0x23, 0x48, 0x2B, 0x8C, 0xCA, 0xB1, 0x95, 0x22, 0x50, 0x2A, 0x8D, 0xB9, 0xC1, 0x93, 0x23, 0x40,
+    0x2B, 0x0D, 0xCA, 0xB1, 0x94, 0x23, 0x40, 0x3B, 0x8C, 0xCA, 0xB1, 0xA4, 0x23, 0x60, 0x2B, 0x8D,
+    0xBA, 0xB1, 0xA4, 0x23, 0x50, 0x3B, 0x8C, 0xCA, 0xB1, 0x94, 0x23, 0x50, 0x2B, 0x8D, 0xB9, 0xC0,
+    0x94, 0x23, 0x40, 0x2B, 0x8C, 0xBA, 0xD1, 0x85, 0x12, 0x40, 0x2B, 0x8C, 0xC9, 0xA1, 0x94, 0x23,
+    0x58, 0x1B, 0x8D, 0xB9, 0xC2, 0x84, 0x32, 0x38, 0x2C, 0x9A, 0xD9, 0xB2, 0x04, 0x32, 0x48, 0x2C,
+    0xAB, 0xD8, 0xA2, 0x05, 0x31, 0x48, 0x1C, 0xAA, 0xD8, 0x92, 0x05, 0x31, 0x39, 0x1C, 0xBA, 0xE0,
+    0x93, 0x13, 0x31, 0x3A, 0x0D, 0xCA, 0xC0, 0x94, 0x23, 0x30, 0x3A, 0x8D, 0xCA, 0xC1, 0x94, 0x32,
+    0x40, 0x2B, 0x9C, 0xC9, 0xB2, 0x84, 0x32, 0x58, 0x1C, 0x9B, 0xC8, 0xA3, 0x04, 0x32, 0x49, 0x1D,
+    0xBA, 0xC8, 0xA3, 0x14, 0x41, 0x3A, 0x0C, 0xCA, 0xB0, 0x94, 0x23, 0x40, 0x3B, 0x9D, 0xC9, 0xB2,
+    0x94, 0x42, 0x48, 0x1C, 0x9B, 0xC8, 0xA3, 0x04, 0x31, 0x49, 0x0C, 0xAB, 0xD0, 0x94, 0x13, 0x31,
+    0x3B, 0x0D, 0xC9, 0xC1, 0x93, 0x24, 0x48, 0x2B, 0x9C, 0xC9, 0xA3, 0x84, 0x42, 0x39, 0x0D, 0xAA,
+    0xC0, 0xA3, 0x13, 0x41, 0x3B, 0x8D, 0xBA, 0xD1, 0x94, 0x23, 0x58, 0x1B, 0x9D, 0xB8, 0xB2, 0x04,
+    0x41, 0x39, 0x1C, 0xBA, 0xE0, 0x93, 0x14, 0x41, 0x2B, 0x8C, 0xCA, 0xA2, 0x84, 0x22, 0x48, 0x1C,
+    0x9B, 0xC8, 0xA3, 0x05, 0x41, 0x3A, 0x8C, 0xB9, 0xF0, 0xA9, 0x51, 0x30, 0xAE, 0x4C, 0x00, 0xC6,
+    0x53, 0x68, 0x2B, 0x9D, 0xC9, 0xA3, 0x84, 0x41, 0x39, 0x0C, 0xBA, 0xC0, 0x93, 0x14, 0x50, 0x2B,
+    0x9C, 0xB9, 0xB2, 0x85, 0x41, 0x49, 0x0B, 0xAB, 0xC0, 0x94, 0x14, 0x40, 0x2B, 0x8B, 0xCA, 0xB2,
+    0x06, 0x32, 0x49, 0x1C, 0xBA, 0xC0, 0xA3, 0x24, 0x40, 0x3B, 0x9C, 0xC9, 0xB2, 0x84, 0x42, 0x39,
+    0x1C, 0xBA, 0xD0, 0x93, 0x14, 0x40, 0x2B, 0x8C, 0xC9, 0xB2, 0x05, 0x31, 0x59, 0x0B, 0xAB, 0xC0,
+    0x95, 0x23, 0x38, 0x3B, 0x9C, 0xD9, 0xB3, 0x04, 0x42, 0x3A, 0x0D, 0xBA, 0xD1, 0x84, 0x22, 0x38,
+    0x2B, 0xAC, 0xD8, 0xA3, 0x14, 0x41, 0x2B, 0x8C, 0xB9, 0xC1, 0x85, 0x31, 0x48, 0x1C, 0xBA, 0xC0,
+    0xA3, 0x24, 0x50, 0x2B, 0x9C, 0xC9, 0xA3, 0x04, 0x41, 0x2A, 0x0C, 0xBA, 0xC1, 0x85, 0x22, 0x49,
+    0x1B, 0xAB, 0xC8, 0xA5, 0x23, 0x40, 0x2B, 0x9D, 0xC8, 0xA2, 0x03, 0x32, 0x4A, 0x0E, 0xB9, 0xD1,
+    0x83, 0x23, 0x48, 0x1D, 0xAB, 0xC0, 0x93, 0x15, 0x40, 0x2B, 0x9C, 0xC8, 0xA2, 0x04, 0x41, 0x2A,
+    0x0C, 0xC9, 0xA1, 0x84, 0x32, 0x39, 0x1C, 0xBA, 0xE0, 0x94, 0x22, 0x40, 0x1C, 0x9A, 0xC8, 0xA3,
+    0x14, 0x40, 0x2B, 0x8C, 0xC9, 0xA3, 0x04, 0x31, 0x3A, 0x0C, 0xCA, 0xC2, 0x84, 0x32, 0x49, 0x0C,
+    0xAA, 0xC0, 0x94, 0x23, 0x48, 0x1C, 0x9B, 0xD8, 0x94, 0x13, 0x40, 0x2B, 0x9D, 0xC8, 0xA2, 0x04,
+    0x41, 0x2A, 0x8C, 0xB9, 0xC2, 0x03, 0x32, 0x4A, 0x0D, 0xBA, 0xC2, 0x84, 0x32, 0x49, 0x0C, 0xBB,
+    0xC1, 0x84, 0x23, 0x49, 0x1C, 0xAA, 0xC8, 0xA4, 0x23, 0x50, 0x1C, 0x9B, 0xC8, 0xA4, 0x13, 0x40,
+    0x2B, 0x9D, 0xC8, 0xA2, 0x14, 0x40, 0x2A, 0x9C, 0xB8, 0xB2, 0x04, 0x51, 0x3A, 0x8C, 0xC9, 0xB2,
+    0x03, 0x32, 0x5A, 0x8D, 0xBA, 0xB2, 0x84, 0x42, 0x4A, 0x8C, 0xAA, 0xC1, 0x85, 0x32, 0x20, 0x4C,
+    0x51, 0x20, 0x5B, 0x52, 0x00, 0x0F, 0xDA, 0xD0, 0x84, 0x22, 0x48, 0x1C, 0xBA, 0xC0, 0x84, 0x22,
+    0x48, 0x1C, 0xBA, 0xB0, 0xA4, 0x32, 0x68, 0x1C, 0xAA, 0xC0, 0x94, 0x22, 0x48, 0x1B, 0xAC, 0xC0,
+    0x94, 0x22, 0x48, 0x1B, 0xAC, 0xC0, 0x93, 0x24, 0x48, 0x1B, 0xAC, 0xC0, 0x93, 0x24, 0x38, 0x2B,
+    0xAC, 0xE0, 0x93, 0x24, 0x48, 0x1B, 0xAC, 0xC0, 0x93, 0x24, 0x48, 0x1B, 0xAC, 0xC0, 0x94, 0x22,
+    0x48, 0x1B, 0xAC, 0xC0, 0x94, 0x22, 0x48, 0x1B, 0xAC, 0xC0, 0x94, 0x22, 0x48, 0x1C, 0xAA, 0xC0,
+    0x94, 0x22, 0x48, 0x1C, 0xBA, 0xB1, 0x93, 0x33, 0x69, 0x0D, 0xBA, 0xB1, 0x94, 0x42, 0x49, 0x0C,
+    0xBA, 0xC1, 0x84, 0x32, 0x49, 0x0D, 0xB9, 0xC1, 0x04, 0x32, 0x3A, 0x8C, 0xC9, 0xB2, 0x04, 0x41,
+    0x3A, 0x8D, 0xD8, 0xA2, 0x04, 0x40, 0x2A, 0x8C, 0xC8, 0xA2, 0x14, 0x40, 0x1B, 0x9B, 0xC8, 0x94,
+    0x14, 0x48, 0x1B, 0x9B, 0xC0, 0x94, 0x23, 0x48, 0x1D, 0xBA, 0xC0, 0x84, 0x22, 0x49, 0x0B, 0xAB,
+    0xC2, 0x85, 0x32, 0x4A, 0x8C, 0xBA, 0xB2, 0x05, 0x41, 0x3A, 0x8C, 0xD9, 0xA3, 0x03, 0x51, 0x2C,
+    0x9C, 0xD8, 0x93, 0x14, 0x40, 0x2C, 0xAA, 0xC0, 0x93, 0x24, 0x49, 0x1C, 0xBA, 0xC1, 0x84, 0x32,
+    0x49, 0x8D, 0xB9, 0xB2, 0x04, 0x41, 0x3A, 0x8D, 0xD8, 0xA2, 0x14, 0x40, 0x1B, 0x9B, 0xC8, 0x95,
+    0x23, 0x49, 0x1B, 0xBC, 0xC1, 0x84, 0x32, 0x39, 0x0C, 0xCA, 0xB2, 0x84, 0x51, 0x3A, 0x9C, 0xC9,
+    0xA3, 0x14, 0x40, 0x2B, 0xAC, 0xC0, 0x93, 0x23, 0x48, 0x1D, 0xBA, 0xC1, 0x84, 0x31, 0x49, 0x8C,
+    0xB9, 0xB2, 0x04, 0x50, 0x2A, 0x9C, 0xC8, 0xA3, 0x24, 0x48, 0x1B, 0xAC, 0xC1, 0x93, 0x33, 0x4A,
+    0x0D, 0xB9, 0xC2, 0x04, 0x41, 0x2B, 0x9C, 0xC8, 0xA3, 0x24, 0x48, 0x1B, 0xAB, 0xC0, 0x95, 0x32,
+    0x49, 0x0C, 0xBA, 0xC2, 0x40, 0x4A, 0x48, 0x50, 0xA3, 0x51, 0x00, 0x76, 0x2F, 0x9D, 0xC8, 0x93,
+    0x14, 0x48, 0x1B, 0xAB, 0xC0, 0x86, 0x32, 0x3A, 0x0C, 0xD9, 0xB2, 0x14, 0x41, 0x2B, 0x9C, 0xD8,
+    0x94, 0x22, 0x48, 0x1C, 0xBA, 0xC1, 0x84, 0x42, 0x3A, 0x9D, 0xC8, 0xA3, 0x13, 0x50, 0x1C, 0xAC,
+    0xC0, 0x94, 0x32, 0x49, 0x0C, 0xCA, 0xB2, 0x15, 0x40, 0x2B, 0x9B, 0xD8, 0x95, 0x22, 0x58, 0x0C,
+    0xBA, 0xC1, 0x05, 0x31, 0x3B, 0x9C, 0xD8, 0xA3, 0x24, 0x48, 0x1C, 0xBA, 0xB1, 0x84, 0x42, 0x4A,
+    0x9C, 0xB9, 0xB3, 0x24, 0x58, 0x1B, 0xAB, 0xC1, 0x85, 0x32, 0x3A, 0x8C, 0xD9, 0xA3, 0x14, 0x48,
+    0x2B, 0xAB, 0xD0, 0x85, 0x32, 0x49, 0x8D, 0xC9, 0xA3, 0x14, 0x40, 0x2C, 0xAA, 0xD0, 0x84, 0x32,
+    0x49, 0x8D, 0xC9, 0xA3, 0x14, 0x40, 0x2C, 0xAA, 0xD0, 0x84, 0x32, 0x4A, 0x8C, 0xC9, 0xA3, 0x14,
+    0x40, 0x2C, 0xBA, 0xC0, 0x85, 0x31, 0x4A, 0x8C, 0xC8, 0xA2, 0x14, 0x50, 0x1C, 0xBA, 0xC1, 0x84,
+    0x41, 0x3A, 0x9C, 0xD8, 0x93, 0x23, 0x48, 0x0D, 0xBA, 0xB2, 0x04, 0x51, 0x2B, 0x9C, 0xD8, 0x94,
+    0x33, 0x49, 0x0D, 0xC9, 0xB2, 0x14, 0x40, 0x2B, 0xAC, 0xC1, 0x93, 0x43, 0x3A, 0x8E, 0xD8, 0xA2,
+    0x24, 0x40, 0x1C, 0xBA, 0xC1, 0x04, 0x31, 0x3A, 0x9D, 0xE0, 0x93, 0x23, 0x59, 0x0D, 0xC9, 0xB2,
+    0x14, 0x50, 0x1B, 0xAC, 0xC1, 0x83, 0x33, 0x3B, 0x8D, 0xD9, 0xA4, 0x23, 0x49, 0x1C, 0xCA, 0xB2,
+    0x14, 0x41, 0x2B, 0xAC, 0xC0, 0x94, 0x32, 0x4A, 0x8C, 0xC9, 0xA3, 0x24, 0x48, 0x1C, 0xBA, 0xC2,
+    0x04, 0x41, 0x2B, 0xAC, 0xC0, 0x94, 0x32, 0x4A, 0x8C, 0xC9, 0xA3, 0x24, 0x48, 0x1C, 0xBA, 0xC2,
+    0x04, 0x41, 0x2B, 0xAC, 0xC0, 0x94, 0x32, 0x4A, 0x8C, 0xC9, 0xA4, 0x23, 0x59, 0x0C, 0xCA, 0xA2,
+    0x05, 0x50, 0x1C, 0xAB, 0xC1, 0x85, 0x31, 0x4A, 0x9C, 0xC8, 0x20, 0x13, 0x4E, 0xD0, 0x8A, 0x50,
+    0x00, 0x67, 0x49, 0x0E, 0xC9, 0xB3, 0x24, 0x48, 0x1C, 0xBA, 0xC2, 0x04, 0x41, 0x2B, 0xAC, 0xC0,
+    0x94, 0x42, 0x3A, 0x9D, 0xC8, 0xA4, 0x32, 0x48, 0x0D, 0xC9, 0xB2, 0x25, 0x48, 0x1C, 0xBA, 0xC2,
+    0x04, 0x41, 0x2C, 0xAB, 0xC1, 0x94, 0x42, 0x3B, 0x9C, 0xD8, 0x94, 0x33, 0x4A, 0x8C, 0xC9, 0xA3,
+    0x24, 0x48, 0x1C, 0xCA, 0xB2, 0x15, 0x50, 0x1C, 0xAB, 0xD2, 0x04, 0x41, 0x2B, 0xAC, 0xC0, 0x94,
+    0x42, 0x3A, 0x9D, 0xD8, 0x94, 0x33, 0x4A, 0x8C, 0xC9, 0xA3, 0x24, 0x48, 0x1C, 0xCA, 0xB2, 0x15,
+    0x58, 0x1B, 0xBB, 0xC2, 0x05, 0x41, 0x2C, 0xAB, 0xD1, 0x85, 0x41, 0x3B, 0xAC, 0xD0, 0x84, 0x32,
+    0x4A, 0x9D, 0xC8, 0x94, 0x33, 0x4A, 0x8C, 0xC9, 0xA3, 0x24, 0x59, 0x0C, 0xC9, 0xB3, 0x24, 0x48,
+    0x1C, 0xBA, 0xC2, 0x15, 0x40, 0x1C, 0xBB, 0xC2, 0x05, 0x40, 0x2B, 0xBC, 0xC1, 0x84, 0x41, 0x3B,
+    0xAC, 0xD0, 0x85, 0x41, 0x2B, 0x9C, 0xD0, 0x84, 0x32, 0x4A, 0x9D, 0xC8, 0x94, 0x33, 0x4A, 0x8D,
+    0xD8, 0x94, 0x22, 0x59, 0x8D, 0xC8, 0xA3, 0x24, 0x59, 0x8C, 0xB9, 0xB3, 0x24, 0x69, 0x0C, 0xC9,
+    0xA3, 0x14, 0x58, 0x0C, 0xBA, 0xC3, 0x14, 0x48, 0x1C, 0xBA, 0xC3, 0x14, 0x40, 0x1C, 0xBB, 0xC2,
+    0x05, 0x50, 0x1C, 0xBA, 0xC1, 0x05, 0x40, 0x2C, 0xBA, 0xC1, 0x05, 0x40, 0x2B, 0xBC, 0xC2, 0x04,
+    0x40, 0x2B, 0xBC, 0xC1, 0x05, 0x40, 0x2B, 0xBC, 0xC1, 0x84, 0x51, 0x2B, 0xBC, 0xC1, 0x84, 0x51,
+    0x2C, 0xBB, 0xC2, 0x84, 0x51, 0x2B, 0xBC, 0xC1, 0x84, 0x51, 0x2C, 0xBB, 0xC1, 0x85, 0x51, 0x2B,
+    0xBC, 0xC1, 0x84, 0x51, 0x2C, 0xBB, 0xC2, 0x04, 0x41, 0x2C, 0xBB, 0xC2, 0x04, 0x41, 0x2C, 0xBB,
+    0xC2, 0x05, 0x40, 0x1C, 0xAA, 0xD1, 0x15, 0x40, 0x1C, 0xBA, 0xC2, 0x04, 0x50, 0x1C, 0xBA, 0xC2
+};
+
+// qpskburst: 4096 I/Q pairs
+static const uint8_t wave1[] =
+{
+    0x60, 0xFF, 0x1D, 0x60, 0xFF, 0x1D, 0x00, 0x77, 0x77, 0x11, 0xFF, 0xAA, 0x88, 0x22, 0x55, 0x55,
+    0x11, 0xDD, 0xFF, 0xDD, 0xBB, 0xAA, 0x88, 0x10, 0x22, 0x88, 0xB9, 0xDB, 0xAA, 0x44, 0x77, 0x57,
+    0x32, 0x02, 0xA1, 0xB8, 0xD8, 0x99, 0x08, 0x39, 0x40, 0x31, 0x13, 0x02, 0x98, 0xBC, 0xAF, 0xCC,
+    0xAB, 0xB9, 0xB1, 0xA4, 0x04, 0x42, 0x61, 0x48, 0x28, 0x09, 0xA9, 0xB8, 0xC1, 0xA1, 0x01, 0x40,
+    0x38, 0x4A, 0x1D, 0x0E, 0x9B, 0xAB, 0xBA, 0xA8, 0xB1, 0xC2, 0xA5, 0xA3, 0x84, 0x42, 0x62, 0x31,
+    0x38, 0x0B, 0xBD, 0xCC, 0xBB, 0xAA, 0x08, 0x40, 0x40, 0x40, 0x18, 0x09, 0x98, 0xA1, 0xB5, 0xB5,
+    0xB4, 0xB3, 0x92, 0x82, 0x19, 0x2B, 0x0F, 0x8B, 0x8B, 0x98, 0x92, 0x15, 0x13, 0x82, 0x09, 0xAC,
+    0x9B, 0x1C, 0x29, 0x50, 0x11, 0x91, 0xF0, 0xC0, 0x88, 0x48, 0x7A, 0x4A, 0x30, 0x13, 0x97, 0xC5,
+    0xC2, 0xA1, 0x98, 0x8C, 0x1B, 0x1B, 0x1A, 0x08, 0x91, 0x93, 0x94, 0x93, 0x03, 0x24, 0x72, 0x40,
+    0x38, 0x3B, 0x1D, 0x0B, 0x9C, 0x9A, 0x9A, 0x89, 0x00, 0x23, 0x15, 0x24, 0x83, 0xC2, 0xF1, 0xD0,
+    0xB9, 0xA9, 0x99, 0x18, 0x18, 0x02, 0x93, 0x84, 0x90, 0x1C, 0x5F, 0x5D, 0x4A, 0x29, 0x22, 0x04,
+    0x83, 0xA1, 0xD8, 0xBC, 0xBC, 0xAA, 0x99, 0x81, 0x01, 0x10, 0x18, 0x09, 0x89, 0xA1, 0xA4, 0x95,
+    0x14, 0x41, 0x70, 0x48, 0x38, 0x48, 0x30, 0x10, 0x90, 0xB8, 0xEC, 0xBC, 0xBC, 0x9B, 0x1A, 0x39,
+    0x60, 0x33, 0x27, 0x13, 0x82, 0xC0, 0xC8, 0xCC, 0xAB, 0x8C, 0x29, 0x58, 0x20, 0x13, 0x93, 0xC4,
+    0xC3, 0x93, 0x20, 0x38, 0x49, 0x19, 0x91, 0xC4, 0xB1, 0x9A, 0x1F, 0x4D, 0x3B, 0x28, 0x92, 0xB3,
+    0xD4, 0xA2, 0x98, 0x0B, 0x1D, 0x1B, 0x8A, 0x08, 0x91, 0x83, 0x83, 0x04, 0x03, 0x03, 0x80, 0x08,
+    0x89, 0x08, 0x80, 0x82, 0x90, 0x09, 0xA0, 0x2F, 0x49, 0xB0, 0xBD, 0x2F, 0x00, 0x6D, 0x0C, 0xBA,
+    0xFA, 0xE9, 0x00, 0x42, 0x77, 0x43, 0x32, 0x40, 0x3A, 0x1C, 0x8B, 0xBA, 0xF1, 0xB3, 0xB6, 0x82,
+    0x22, 0x40, 0x49, 0x1A, 0x8B, 0xBC, 0xCB, 0xBA, 0xA8, 0x80, 0x10, 0x30, 0x38, 0x49, 0x29, 0x41,
+    0x26, 0x16, 0x83, 0xB2, 0xE0, 0xB8, 0xB9, 0x98, 0x10, 0x41, 0x40, 0x38, 0x2D, 0x1C, 0x9C, 0xBB,
+    0xDA, 0xB9, 0xB0, 0xA4, 0x94, 0x14, 0x12, 0x01, 0x99, 0xBB, 0x9C, 0x2C, 0x7A, 0x79, 0x21, 0x13,
+    0x95, 0xA3, 0xB3, 0xC0, 0xAA, 0x9E, 0x1B, 0x39, 0x41, 0x54, 0x24, 0x01, 0xA8, 0xCA, 0xBC, 0x9B,
+    0x19, 0x48, 0x41, 0x12, 0x83, 0xA4, 0xD3, 0xA2, 0x90, 0x88, 0x1A, 0x28, 0x21, 0x34, 0x31, 0x3A,
+    0x2F, 0x1D, 0x9A, 0xB8, 0xE1, 0xB4, 0xB3, 0xC1, 0xA9, 0xAD, 0x0B, 0x49, 0x51, 0x34, 0x33, 0x12,
+    0x98, 0xCB, 0xCD, 0xBA, 0xAA, 0x89, 0x11, 0x32, 0x35, 0x53, 0x22, 0x31, 0x2A, 0x1D, 0x8B, 0xBA,
+    0xE1, 0xB4, 0xC3, 0xA4, 0x81, 0x88, 0x09, 0x19, 0x09, 0x10, 0x80, 0x91, 0xB1, 0xB1, 0x08, 0x5A,
+    0x7E, 0x4D, 0x3B, 0x1A, 0x99, 0xC0, 0xC0, 0xA1, 0x91, 0x00, 0x18, 0x1A, 0x89, 0x9A, 0x90, 0x03,
+    0x57, 0x47, 0x42, 0x22, 0x01, 0x08, 0x98, 0x89, 0x98, 0x88, 0x00, 0x11, 0x21, 0x00, 0x88, 0xBA,
+    0xEE, 0xDD, 0xBB, 0xCC, 0x99, 0x89, 0x01, 0x22, 0x44, 0x34, 0x43, 0x22, 0x31, 0x18, 0x88, 0xC9,
+    0xC9, 0xD1, 0xA0, 0x91, 0x28, 0x3B, 0x49, 0x31, 0x15, 0x83, 0x91, 0x9E, 0x8E, 0x0C, 0x0B, 0x19,
+    0x81, 0x85, 0x83, 0x82, 0x01, 0x18, 0x0A, 0x89, 0xA1, 0x93, 0x81, 0x1A, 0x5F, 0x4C, 0x1B, 0xD9,
+    0xF2, 0xD4, 0xB4, 0xA1, 0x98, 0x1A, 0x0C, 0x1B, 0x9A, 0x99, 0x81, 0x13, 0x55, 0x53, 0x43, 0x20,
+    0x2A, 0x0E, 0x8B, 0xA9, 0xD2, 0xB4, 0xC4, 0x91, 0x89, 0x0B, 0x0C, 0x1A, 0x50, 0xB5, 0x50, 0x70,
+    0xBC, 0x40, 0x00, 0xF2, 0x94, 0x23, 0x72, 0x50, 0x39, 0x0A, 0x9D, 0xDB, 0xAA, 0x99, 0x01, 0x34,
+    0x44, 0x33, 0x01, 0x08, 0x99, 0x9A, 0x98, 0x81, 0x11, 0x10, 0x18, 0x09, 0x89, 0xA1, 0xE2, 0xC2,
+    0xC8, 0xBC, 0xAF, 0x8C, 0x1C, 0x3B, 0x4A, 0x38, 0x51, 0x23, 0x24, 0x03, 0x84, 0xB3, 0xC3, 0xB1,
+    0xC8, 0xBC, 0xBD, 0xAC, 0x0A, 0x49, 0x61, 0x43, 0x25, 0x03, 0xA1, 0xB1, 0xC9, 0xAB, 0x0C, 0x3B,
+    0x5C, 0x3A, 0x28, 0x00, 0x91, 0xA0, 0xD8, 0xB9, 0xA9, 0x91, 0x15, 0x45, 0x44, 0x32, 0x12, 0x80,
+    0x98, 0x9A, 0x8D, 0x0B, 0x0C, 0x09, 0x08, 0x80, 0x81, 0x80, 0x09, 0x1A, 0x09, 0x82, 0xA7, 0x94,
+    0x83, 0x11, 0x59, 0x4B, 0x0D, 0xCB, 0xFA, 0xE8, 0xB1, 0xA3, 0x83, 0x05, 0x23, 0x82, 0x80, 0xB8,
+    0x98, 0x29, 0x71, 0x51, 0x31, 0x09, 0x9F, 0xCD, 0xBB, 0xAA, 0x08, 0x41, 0x31, 0x40, 0x19, 0x0B,
+    0x99, 0xA2, 0xB7, 0xA6, 0xB2, 0xC0, 0xA9, 0xAC, 0x8B, 0x49, 0x62, 0x34, 0x33, 0x02, 0xAA, 0xDD,
+    0xBB, 0xA9, 0x11, 0x44, 0x33, 0x42, 0x18, 0x8C, 0xAB, 0x8B, 0x8A, 0x01, 0x01, 0x01, 0x00, 0x88,
+    0x89, 0x89, 0x01, 0x01, 0x80, 0x88, 0x0A, 0x0B, 0x89, 0x85, 0x07, 0x04, 0x83, 0x83, 0x81, 0x38,
+    0x28, 0xA9, 0xB9, 0xF8, 0xA0, 0x21, 0x72, 0x51, 0x08, 0xCC, 0xEE, 0xCD, 0xBB, 0xAC, 0x19, 0x49,
+    0x41, 0x32, 0x24, 0x04, 0x93, 0xB2, 0xB1, 0xD0, 0xB9, 0xA9, 0x89, 0x08, 0x10, 0x02, 0x92, 0xA1,
+    0xA9, 0x3B, 0x7F, 0x6E, 0x2B, 0x1B, 0x9A, 0xA9, 0xC1, 0xB3, 0xA5, 0x94, 0x13, 0x32, 0x51, 0x48,
+    0x38, 0x09, 0xB9, 0xC1, 0xC0, 0x91, 0x18, 0x4B, 0x39, 0x21, 0x84, 0xC5, 0xC1, 0xAC, 0x8F, 0x0D,
+    0x1A, 0x08, 0x01, 0xA5, 0x82, 0x01, 0x49, 0x5C, 0x3B, 0x29, 0x01, 0x84, 0x93, 0x82, 0x08, 0x1B,
+    0x1D, 0x9B, 0xB0, 0x94, 0x4E, 0xC0, 0x2E, 0x48, 0x00, 0xF9, 0xB1, 0xA3, 0x95, 0x04, 0x12, 0x10,
+    0x0A, 0x9C, 0x8B, 0x9A, 0x11, 0x14, 0x04, 0x83, 0xB1, 0xA9, 0x09, 0x59, 0x68, 0x41, 0x41, 0x30,
+    0x38, 0x1A, 0x89, 0xC1, 0xD3, 0xB3, 0xB1, 0x9E, 0x1E, 0x4D, 0x4A, 0x39, 0x21, 0x12, 0x95, 0xB2,
+    0xD2, 0xB1, 0xA9, 0xBA, 0x9D, 0x8B, 0x0A, 0x29, 0x11, 0x03, 0x86, 0xA2, 0xA2, 0xA0, 0x08, 0x4B,
+    0x7B, 0x6D, 0x3A, 0x2A, 0x08, 0x80, 0x91, 0x80, 0x09, 0x1A, 0x19, 0x91, 0xD7, 0xE5, 0xB3, 0xA1,
+    0x89, 0x0B, 0x1C, 0x0B, 0x9B, 0x99, 0x91, 0x13, 0x77, 0x53, 0x22, 0x10, 0x9A, 0xBD, 0xCB, 0xB9,
+    0x92, 0x04, 0x14, 0x11, 0x09, 0x8C, 0x8B, 0x8A, 0x82, 0x84, 0x04, 0x01, 0x19, 0x0C, 0x0B, 0x89,
+    0xC1, 0xA4, 0x03, 0x51, 0x68, 0x5B, 0x3C, 0x4B, 0x19, 0x18, 0x91, 0xA2, 0xC3, 0xC3, 0xB4, 0xA3,
+    0x93, 0x81, 0x08, 0x2C, 0x1D, 0x0C, 0x8A, 0xA9, 0xA1, 0x93, 0x15, 0x33, 0x71, 0x60, 0x39, 0x3A,
+    0x2C, 0x1A, 0x9B, 0xBB, 0xDB, 0xCA, 0xB0, 0xA5, 0x94, 0x05, 0x02, 0x11, 0x0A, 0x0B, 0x8C, 0x9B,
+    0x89, 0x80, 0x00, 0x02, 0x11, 0x18, 0x08, 0x99, 0xCA, 0xB8, 0x00, 0x63, 0x76, 0x45, 0x44, 0x33,
+    0x22, 0x00, 0x99, 0xBA, 0xCD, 0xBA, 0xDB, 0xAC, 0xAA, 0x89, 0x00, 0x23, 0x56, 0x44, 0x22, 0x20,
+    0x19, 0x8B, 0x8C, 0x9B, 0x89, 0x08, 0x01, 0x02, 0x01, 0x88, 0x89, 0x89, 0x09, 0x19, 0x01, 0x82,
+    0xA7, 0xA4, 0x84, 0x22, 0x63, 0x31, 0x88, 0xEB, 0xEF, 0xCB, 0xCB, 0xB8, 0xB2, 0x95, 0x03, 0x31,
+    0x78, 0x4C, 0x2C, 0x0A, 0xA9, 0xC1, 0xB1, 0x91, 0x19, 0x5A, 0x39, 0x12, 0x85, 0xA5, 0xD2, 0xB1,
+    0x98, 0x9B, 0x1C, 0x2C, 0x59, 0x39, 0x20, 0x03, 0xA4, 0xC4, 0xB2, 0xA0, 0x0A, 0x3B, 0x6D, 0x39,
+    0x20, 0x13, 0x94, 0xB3, 0xD2, 0xB0, 0xA9, 0x9B, 0x80, 0x1C, 0x53, 0x40, 0xC6, 0x45, 0x00, 0x7A,
+    0x4A, 0x39, 0x28, 0x18, 0x90, 0xB0, 0xD1, 0xB0, 0xA8, 0xB9, 0x99, 0x89, 0x18, 0x13, 0x07, 0x04,
+    0x93, 0x83, 0x81, 0x08, 0x08, 0x09, 0x89, 0x89, 0x01, 0x01, 0x82, 0x81, 0x09, 0x1B, 0x9F, 0x8D,
+    0x0C, 0x1B, 0x8A, 0xC9, 0xB0, 0x23, 0x57, 0x73, 0x13, 0x90, 0xFA, 0xCD, 0x9B, 0x49, 0x70, 0x53,
+    0x25, 0x03, 0x92, 0xD8, 0xA9, 0x9A, 0x1B, 0x4B, 0x3B, 0x1D, 0x9A, 0xC9, 0xC0, 0x93, 0x16, 0x33,
+    0x43, 0x11, 0x89, 0xBC, 0xCC, 0xAB, 0x9A, 0x09, 0x11, 0x13, 0x05, 0x03, 0x83, 0x92, 0xA1, 0x90,
+    0x88, 0x4A, 0x59, 0x58, 0x30, 0x12, 0x92, 0xC1, 0xC8, 0xAC, 0x9F, 0x0C, 0x1B, 0x1C, 0x0B, 0x89,
+    0x90, 0x83, 0x07, 0x13, 0x13, 0x90, 0xBA, 0xCD, 0x9B, 0x49, 0x70, 0x64, 0x24, 0x02, 0xA1, 0xB8,
+    0xC9, 0x99, 0x18, 0x48, 0x41, 0x10, 0x91, 0xB1, 0xC0, 0x9B, 0x0D, 0x3E, 0x4B, 0x2B, 0x18, 0x90,
+    0x91, 0x91, 0x19, 0x29, 0x19, 0x91, 0xE6, 0xD5, 0xA4, 0x91, 0x20, 0x48, 0x39, 0x18, 0x91, 0xC2,
+    0xB1, 0xAA, 0x0E, 0x3D, 0x5B, 0x38, 0x22, 0x03, 0x85, 0xB1, 0xD8, 0xCA, 0xAC, 0x8B, 0x2A, 0x59,
+    0x21, 0x13, 0x95, 0xC3, 0xB2, 0xA1, 0x19, 0x5D, 0x3B, 0x1B, 0x89, 0xB1, 0xD2, 0xA0, 0x88, 0x0B,
+    0x1A, 0x12, 0x97, 0xA6, 0x92, 0x20, 0x59, 0x5C, 0x2B, 0x19, 0xA2, 0xC4, 0xB3, 0x92, 0x0A, 0x4D,
+    0x4B, 0x29, 0x11, 0x84, 0x94, 0x91, 0x89, 0x0B, 0x0C, 0x09, 0x00, 0x03, 0x84, 0x82, 0x81, 0x99,
+    0x99, 0x19, 0x41, 0x42, 0x01, 0xC9, 0xFE, 0xCD, 0xBA, 0x98, 0x11, 0x34, 0x53, 0x31, 0x29, 0x1B,
+    0x9D, 0xBA, 0xD9, 0xC1, 0xA1, 0x90, 0x38, 0x59, 0x38, 0x10, 0xA4, 0xD5, 0xB4, 0x91, 0x10, 0x48,
+    0x38, 0x28, 0x80, 0xB1, 0xD0, 0xB9, 0x9C, 0x8D, 0x1C, 0x2A, 0x38, 0x38, 0x31, 0x31, 0xF0, 0xC3,
+    0x22, 0x50, 0x5A, 0x44, 0x00, 0x3F, 0x9F, 0xFF, 0xE9, 0xB5, 0xA1, 0x99, 0x1D, 0x3C, 0x58, 0x34,
+    0x37, 0x06, 0x82, 0xC3, 0xC0, 0xB0, 0xB9, 0x99, 0x18, 0x40, 0x41, 0x40, 0x18, 0x0A, 0x89, 0xB1,
+    0xB3, 0xC6, 0xA1, 0xBC, 0x8F, 0x0C, 0x1A, 0x08, 0x81, 0x94, 0x83, 0x12, 0x59, 0x5B, 0x4D, 0x3B,
+    0x29, 0x10, 0x81, 0xB1, 0xF0, 0xB0, 0xB0, 0x89, 0x2B, 0x69, 0x38, 0x04, 0x96, 0xC5, 0xC2, 0x91,
+    0x19, 0x4B, 0x3D, 0x1A, 0x99, 0xC8, 0xB1, 0xA1, 0x21, 0x40, 0x38, 0x29, 0x9A, 0xCA, 0xC9, 0x94,
+    0x07, 0x24, 0x43, 0x20, 0x29, 0x0C, 0x8C, 0xB9, 0xC0, 0xB2, 0xB4, 0x83, 0x02, 0x41, 0x49, 0x4B,
+    0x1D, 0x0B, 0x9B, 0xA8, 0xB2, 0xB5, 0xB3, 0xB2, 0xB8, 0x9C, 0x0B, 0x4D, 0x59, 0x49, 0x31, 0x22,
+    0x14, 0x84, 0x82, 0x90, 0x8A, 0x8D, 0x1A, 0x09, 0x01, 0x04, 0x84, 0x81, 0x99, 0xAC, 0x9B, 0x19,
+    0x71, 0x44, 0x13, 0xC1, 0xF8, 0xCB, 0xBD, 0x8A, 0x18, 0x50, 0x31, 0x10, 0x98, 0xB9, 0xC8, 0xB0,
+    0x94, 0x04, 0x14, 0x11, 0x01, 0x08, 0x88, 0x99, 0xA8, 0xA0, 0x90, 0x41, 0x78, 0x68, 0x28, 0x00,
+    0xA8, 0xB1, 0xC0, 0x98, 0x19, 0x4B, 0x39, 0x21, 0x87, 0xB5, 0xD1, 0xBC, 0x9F, 0x8C, 0x1A, 0x29,
+    0x32, 0x35, 0x23, 0x41, 0x3A, 0x1C, 0x0B, 0xCA, 0xD2, 0xC4, 0xB3, 0x82, 0x28, 0x4B, 0x4D, 0x1B,
+    0x8A, 0xC8, 0xB0, 0xA3, 0x95, 0x13, 0x13, 0x00, 0x8A, 0x9D, 0x8B, 0x1A, 0x30, 0x64, 0x44, 0x23,
+    0x22, 0x10, 0x89, 0xBB, 0xEC, 0xCC, 0xAA, 0x88, 0x20, 0x53, 0x24, 0x14, 0x92, 0xC1, 0xB9, 0xAA,
+    0x1E, 0x4B, 0x4A, 0x18, 0x82, 0xA5, 0xC3, 0xA1, 0xAA, 0x9C, 0x1C, 0x39, 0x41, 0x44, 0x23, 0x01,
+    0xA8, 0xDB, 0xBD, 0x9A, 0x28, 0x58, 0x31, 0x11, 0x90, 0xD0, 0xA8, 0xA9, 0x19, 0x4A, 0x30, 0x12,
+    0x87, 0xB4, 0xD3, 0xA1, 0x10, 0x3E, 0x4C, 0x20, 0x9C, 0x50, 0x00, 0x8C, 0x1C, 0x1B, 0x0A, 0x09,
+    0x81, 0x83, 0xA6, 0xA2, 0x02, 0x31, 0x79, 0x5B, 0x2D, 0x1B, 0x99, 0xB8, 0xD1, 0xA2, 0x94, 0x02,
+    0x13, 0x13, 0x83, 0x93, 0x98, 0x1D, 0x4D, 0x6C, 0x3B, 0x28, 0x02, 0x84, 0x93, 0x82, 0x08, 0x1B,
+    0x0E, 0x9A, 0xCA, 0xE9, 0xB1, 0xB2, 0xA5, 0x93, 0x13, 0x30, 0x5B, 0x4D, 0x3B, 0x29, 0x11, 0x86,
+    0x92, 0x82, 0x9A, 0x1B, 0x0D, 0x19, 0x81, 0xB3, 0x94, 0x11, 0x58, 0x3B, 0x0C, 0xDA, 0xF9, 0xC0,
+    0xA1, 0xA1, 0x10, 0x30, 0x59, 0x38, 0x2A, 0x18, 0x90, 0xB2, 0xD5, 0xB5, 0xB3, 0x94, 0x12, 0x40,
+    0x49, 0x3A, 0x3C, 0x0B, 0x8C, 0xCB, 0xC9, 0xB9, 0xB1, 0x92, 0x15, 0x53, 0x43, 0x24, 0x12, 0x92,
+    0x90, 0x9C, 0x1E, 0x2B, 0x2B, 0xA8, 0xF2, 0xC6, 0xB3, 0x80, 0x29, 0x5C, 0x3C, 0x09, 0x91, 0xC4,
+    0xB3, 0xA1, 0x19, 0x5C, 0x3B, 0x19, 0x81, 0xB3, 0xD5, 0xA1, 0x88, 0x0A, 0x1C, 0x1B, 0x99, 0xA8,
+    0x91, 0x22, 0x53, 0x53, 0x23, 0x14, 0xA2, 0xC1, 0xB8, 0x9B, 0x0E, 0x4B, 0x4B, 0x2A, 0x19, 0x98,
+    0x90, 0x91, 0x11, 0x21, 0x18, 0x9A, 0xEB, 0xDB, 0xA8, 0x96, 0x27, 0x44, 0x33, 0x11, 0x99, 0xCC,
+    0xCC, 0x9A, 0x09, 0x31, 0x41, 0x30, 0x08, 0x9B, 0x99, 0x82, 0x06, 0x25, 0x13, 0xA0, 0xDA, 0xDC,
+    0xBC, 0x88, 0x11, 0x33, 0x54, 0x21, 0x18, 0x8C, 0x8B, 0x9A, 0x90, 0x83, 0x05, 0x12, 0x22, 0x20,
+    0x09, 0xCA, 0xFB, 0xBC, 0xBB, 0xAA, 0x18, 0x40, 0x50, 0x21, 0x29, 0x09, 0x99, 0xA1, 0xC7, 0xB4,
+    0xB4, 0xA2, 0x90, 0x18, 0x18, 0x09, 0x90, 0xB8, 0xA0, 0x31, 0x78, 0x70, 0x38, 0x08, 0x98, 0xC9,
+    0xB8, 0x91, 0x13, 0x33, 0x48, 0x3E, 0x1F, 0x8C, 0x9C, 0x9B, 0x8A, 0x88, 0x01, 0x12, 0x25, 0x24,
+    0x12, 0xC2, 0xF1, 0xE9, 0xA9, 0x88, 0x21, 0x32, 0x41, 0x1A, 0x60, 0x29, 0x4C, 0xD0, 0x3C, 0x4D,
+    0x00, 0xEE, 0xBA, 0x99, 0x11, 0x33, 0x54, 0x13, 0x80, 0xA8, 0xBA, 0xC8, 0xA1, 0x82, 0x11, 0x2A,
+    0x4F, 0x3C, 0x3A, 0x19, 0x90, 0xC4, 0xC3, 0xC3, 0x92, 0x80, 0x09, 0x3B, 0x3C, 0x3B, 0x4B, 0x2C,
+    0x1A, 0x88, 0x80, 0x93, 0x85, 0x03, 0x13, 0x04, 0x82, 0x92, 0x98, 0x1C, 0x3D, 0x2B, 0x8C, 0xD8,
+    0xF1, 0xD3, 0xB5, 0xC2, 0xA1, 0x88, 0x09, 0x39, 0x58, 0x40, 0x21, 0x10, 0x98, 0xC0, 0xC8, 0xA0,
+    0x89, 0x09, 0x19, 0x01, 0x85, 0x93, 0x81, 0x0D, 0x4F, 0x4C, 0x4B, 0x39, 0x21, 0x13, 0x85, 0xB3,
+    0xF2, 0xB1, 0xB9, 0x8B, 0x2E, 0x5B, 0x3A, 0x28, 0x92, 0xC4, 0xB4, 0xC1, 0x98, 0x0B, 0x2C, 0x0B,
+    0x0A, 0x89, 0x91, 0x83, 0x15, 0x04, 0x02, 0x80, 0x9A, 0xBB, 0x8D, 0x49, 0x70, 0x42, 0x35, 0x33,
+    0x11, 0x80, 0x89, 0x9A, 0x9B, 0x9C, 0x1B, 0x1A, 0x28, 0x20, 0x81, 0xC0, 0xF8, 0xDA, 0xB9, 0xA1,
+    0x97, 0x14, 0x14, 0x02, 0x90, 0x90, 0x99, 0x18, 0x69, 0x58, 0x48, 0x12, 0x02, 0x82, 0x90, 0x8C,
+    0x1F, 0x2C, 0x1B, 0xA9, 0xE1, 0xD4, 0xA4, 0x92, 0x21, 0x48, 0x39, 0x19, 0x80, 0xC1, 0xC0, 0xA8,
+    0x9C, 0x1C, 0x1C, 0x0B, 0x8A, 0x99, 0x90, 0x13, 0x47, 0x53, 0x33, 0x20, 0x1A, 0x0D, 0x9B, 0x9A,
+    0x81, 0x94, 0x04, 0x12, 0x31, 0x39, 0x89, 0xD9, 0xF1, 0xC1, 0xB1, 0x99, 0x1D, 0x4D, 0x4B, 0x29,
+    0x11, 0x84, 0x84, 0x92, 0x90, 0x88, 0x09, 0x18, 0x20, 0x30, 0x01, 0xC9, 0xFB, 0xCE, 0xBB, 0x8B,
+    0x1A, 0x59, 0x21, 0x23, 0x85, 0xB4, 0xD3, 0xA2, 0xA0, 0x88, 0x18, 0x28, 0x30, 0x41, 0x30, 0x29,
+    0x0D, 0x8E, 0x8B, 0x9B, 0x1B, 0x19, 0x01, 0x93, 0xD7, 0xE3, 0xB3, 0xB1, 0xAA, 0x9C, 0x1C, 0x2A,
+    0x69, 0x38, 0x41, 0x11, 0x01, 0x80, 0x89, 0x99, 0x19, 0x39, 0x10, 0xA2, 0xF7, 0xD5, 0xB3, 0x83,
+    0xA0, 0x57, 0x37, 0x70, 0xC9, 0x48, 0x00, 0x7F, 0x3E, 0x28, 0x81, 0xB5, 0xE2, 0xBB, 0x9F, 0x8E,
+    0x1B, 0x28, 0x32, 0x44, 0x23, 0x21, 0x19, 0x0C, 0x8C, 0x99, 0x90, 0x82, 0x04, 0x23, 0x21, 0x10,
+    0x09, 0xCA, 0xFB, 0xDC, 0xBB, 0xAA, 0x98, 0x10, 0x12, 0x00, 0x99, 0xAC, 0x99, 0x22, 0x77, 0x55,
+    0x32, 0x10, 0x99, 0xCC, 0xBB, 0xB9, 0x91, 0x84, 0x13, 0x22, 0x18, 0x8B, 0x8D, 0xAB, 0x9A, 0x98,
+    0x80, 0x33, 0x75, 0x64, 0x31, 0x21, 0x0A, 0x8C, 0xAA, 0x0A, 0x00, 0x23, 0x15, 0x93, 0xF2, 0xD8,
+    0xA8, 0x9B, 0x1B, 0x2C, 0x4B, 0x3A, 0x29, 0x18, 0x80, 0xC1, 0xC1, 0xB0, 0xB8, 0x8A, 0x2A, 0x69,
+    0x31, 0x14, 0x96, 0xC6, 0xC3, 0x93, 0x02, 0x20, 0x49, 0x2B, 0x2C, 0x1C, 0x9B, 0xBB, 0xCB, 0xBA,
+    0xA8, 0x95, 0x05, 0x45, 0x52, 0x20, 0x2A, 0x0C, 0x9B, 0xB9, 0xA1, 0xB5, 0xC3, 0xB1, 0xB9, 0xAC,
+    0x0C, 0x49, 0x61, 0x44, 0x23, 0x01, 0xA9, 0xBC, 0xCC, 0xA8, 0x10, 0x24, 0x52, 0x31, 0x29, 0x1B,
+    0x9C, 0xB9, 0xD1, 0xC3, 0xA4, 0x82, 0x29, 0x5B, 0x2C, 0x1B, 0x98, 0xB8, 0xD1, 0x91, 0x01, 0x20,
+    0x49, 0x39, 0x19, 0x09, 0x90, 0xA3, 0xB6, 0xC5, 0xB3, 0xA3, 0x81, 0x08, 0x18, 0x09, 0x89, 0xA9,
+    0x80, 0x12, 0x63, 0x43, 0x48, 0x3D, 0x2F, 0x1D, 0x8A, 0xB9, 0xE0, 0xC3, 0xA5, 0x92, 0x22, 0x31,
+    0x49, 0x3B, 0x1C, 0x8C, 0x9A, 0x98, 0x91, 0x12, 0x15, 0x03, 0x82, 0x90, 0x98, 0x1B, 0x3D, 0x2C,
+    0x8A, 0xD8, 0xE1, 0xC3, 0xC4, 0xB3, 0xB2, 0x98, 0x0A, 0x39, 0x78, 0x40, 0x21, 0x00, 0xA0, 0xC8,
+    0xB9, 0x90, 0x18, 0x51, 0x31, 0x19, 0x89, 0xBB, 0xC9, 0xB1, 0xA7, 0x85, 0x10, 0x3B, 0x3F, 0x4E,
+    0x2A, 0x49, 0x21, 0x13, 0x84, 0xB2, 0xE2, 0xC8, 0xA9, 0x89, 0x19, 0x30, 0x50, 0x21, 0x11, 0x91,
+    0x98, 0x9B, 0x1E, 0x2C, 0x1C, 0xAB, 0x10, 0xA0, 0x3D, 0x60, 0x29, 0x4E, 0x00, 0xDE, 0xA2, 0x97,
+    0x15, 0x34, 0x43, 0x30, 0x09, 0x8C, 0xAB, 0x8B, 0x1A, 0x20, 0x11, 0xA2, 0xE0, 0xD8, 0xBA, 0x98,
+    0x10, 0x42, 0x32, 0x39, 0x1C, 0x0D, 0xA8, 0x93, 0x87, 0x06, 0x22, 0x01, 0x9A, 0x9C, 0xAB, 0x19,
+    0x41, 0x44, 0x14, 0xC1, 0xF8, 0xCB, 0xBC, 0x8A, 0x19, 0x51, 0x31, 0x10, 0x98, 0xB9, 0xD8, 0xA0,
+    0x94, 0x14, 0x13, 0x04, 0x82, 0x91, 0x88, 0x0B, 0x4E, 0x5C, 0x4A, 0x18, 0x02, 0x84, 0x83, 0x82,
+    0x0A, 0x1D, 0x0B, 0x9A, 0xC1, 0xE4, 0xB4, 0xA1, 0x88, 0x0A, 0x1C, 0x0B, 0x89, 0x98, 0x82, 0x12,
+    0x42, 0x63, 0x33, 0x34, 0x22, 0x11, 0x99, 0xBB, 0xDC, 0xBC, 0xBB, 0xCB, 0xAB, 0xAB, 0x00, 0x34,
+    0x77, 0x43, 0x23, 0x00, 0xAA, 0xCD, 0xBB, 0x99, 0x10, 0x54, 0x34, 0x12, 0x81, 0xA9, 0xD9, 0xB8,
+    0x90, 0x82, 0x01, 0x3A, 0x4D, 0x3D, 0x3A, 0x19, 0xA0, 0xC3, 0xD5, 0xA3, 0x91, 0x00, 0x18, 0x1B,
+    0x0C, 0x8A, 0x9B, 0x8B, 0x89, 0x00, 0x10, 0x82, 0x00, 0x98, 0x89, 0x08, 0x18, 0x28, 0x10, 0x90,
+    0xF1, 0xB2, 0x98, 0x59, 0x7D, 0x4A, 0x38, 0x16, 0x96, 0xC5, 0xC3, 0xA4, 0x92, 0x08, 0x08, 0x1A,
+    0x1C, 0x0B, 0x9B, 0x8C, 0xAB, 0x89, 0x80, 0x34, 0x65, 0x53, 0x33, 0x31, 0x19, 0x8C, 0x9C, 0x9B,
+    0x8B, 0x10, 0x01, 0x13, 0x83, 0xB4, 0x94, 0x12, 0x52, 0x31, 0x09, 0xDA, 0xFD, 0xCB, 0xBC, 0x9B,
+    0x19, 0x49, 0x40, 0x23, 0x15, 0x84, 0x93, 0x92, 0x01, 0x19, 0x19, 0x88, 0xD1, 0xD3, 0xB2, 0xAB,
+    0x8F, 0x1F, 0x1A, 0x09, 0x92, 0xB4, 0x92, 0x21, 0x79, 0x6B, 0x2C, 0x0A, 0x90, 0xC3, 0xB4, 0x83,
+    0x13, 0x30, 0x58, 0x1C, 0x8C, 0xBB, 0xCB, 0xB8, 0x82, 0x15, 0x13, 0x02, 0x88, 0xAC, 0x9C, 0x1B,
+    0x69, 0x48, 0x31, 0x12, 0xA3, 0xC3, 0xC4, 0x93, 0x02, 0x23, 0x48, 0x3C, 0xA0, 0x1A, 0x4A, 0x50,
+    0x6B, 0x3D, 0x00, 0x5F, 0xCA, 0xF8, 0xE1, 0xB4, 0xB3, 0x81, 0x38, 0x5B, 0x3C, 0x1C, 0x9A, 0xD8,
+    0xB1, 0xA2, 0x14, 0x34, 0x52, 0x20, 0x19, 0x8B, 0x8D, 0x9A, 0x99, 0x00, 0x01, 0x11, 0x10, 0x08,
+    0x89, 0xA8, 0xD0, 0xD8, 0xB0, 0xB8, 0xC1, 0x81, 0x08, 0x38, 0x5B, 0x4B, 0x30, 0x06, 0x96, 0xC4,
+    0xC4, 0xA3, 0x93, 0x11, 0x18, 0x1C, 0x9D, 0xAB, 0x9B, 0x29, 0x61, 0x44, 0x34, 0x13, 0x92, 0xB1,
+    0xD8, 0xBC, 0xAC, 0x9C, 0x1A, 0x39, 0x63, 0x34, 0x24, 0x01, 0xA9, 0xCC, 0xCB, 0x9A, 0x00, 0x43,
+    0x35, 0x33, 0x11, 0x90, 0x99, 0x9A, 0x0B, 0x1B, 0x1A, 0x9C, 0xCB, 0xD9, 0xC8, 0xA4, 0xA6, 0x83,
+    0x12, 0x21, 0x3A, 0x5D, 0x2B, 0x3A, 0x31, 0x24, 0x83, 0xC4, 0xE1, 0xB8, 0xBA, 0x88, 0x18, 0x40,
+    0x41, 0x20, 0x28, 0x8A, 0x98, 0xA0, 0x83, 0x14, 0x11, 0x0C, 0x8F, 0xAD, 0x9A, 0x18, 0x31, 0x54,
+    0x12, 0xC2, 0xF8, 0xCB, 0xBC, 0x8C, 0x19, 0x58, 0x31, 0x12, 0x93, 0xB2, 0xC2, 0xB4, 0x92, 0x02,
+    0x18, 0x1B, 0x0F, 0x0C, 0x8A, 0x90, 0xA1, 0x94, 0x03, 0x31, 0x79, 0x4D, 0x4B, 0x29, 0x11, 0x84,
+    0x84, 0x91, 0x99, 0x0B, 0x0C, 0x19, 0x10, 0x12, 0x04, 0xB3, 0xF1, 0xE0, 0xA9, 0xBA, 0x8B, 0x8C,
+    0x1A, 0x1A, 0x09, 0x88, 0x90, 0x82, 0x00, 0x29, 0x18, 0x99, 0xC0, 0xB3, 0x81, 0x59, 0x7D, 0x4B,
+    0x28, 0x25, 0x97, 0xB4, 0xD3, 0xB1, 0xA9, 0x9C, 0x0C, 0x4A, 0x49, 0x38, 0x31, 0x01, 0xA1, 0xD0,
+    0xB8, 0xA9, 0x0A, 0x5A, 0x30, 0x33, 0x17, 0x96, 0x92, 0x91, 0x09, 0x2B, 0x1D, 0x9A, 0xD8, 0xD0,
+    0xB1, 0xB0, 0x80, 0x0A, 0x18, 0x00, 0x84, 0x95, 0x84, 0x11, 0x50, 0x58, 0x39, 0x48, 0x21, 0x12,
+    0x80, 0xB9, 0xEE, 0xCC, 0xAB, 0x89, 0x21, 0x43, 0x45, 0x03, 0x92, 0xC8, 0xB9, 0x9A, 0x1B, 0x5C,
+    0x3B, 0x1B, 0xC0, 0xA7, 0x3F, 0x70, 0x42, 0x4B, 0x00, 0xFC, 0xB1, 0xA7, 0x15, 0x44, 0x33, 0x22,
+    0x81, 0xB8, 0xD9, 0xA8, 0xA0, 0x81, 0x10, 0x29, 0x3D, 0x4E, 0x3B, 0x2B, 0x0A, 0x88, 0x90, 0x83,
+    0x15, 0x33, 0x13, 0xA4, 0xF2, 0xF2, 0xA8, 0x9C, 0x2D, 0x4C, 0x3A, 0x08, 0x91, 0xC3, 0xC4, 0x93,
+    0x11, 0x40, 0x39, 0x1A, 0x98, 0xC8, 0xB1, 0xA1, 0x21, 0x41, 0x40, 0x1B, 0x9F, 0xCE, 0xBB, 0x9A,
+    0x18, 0x40, 0x32, 0x10, 0x9A, 0xB9, 0xD9, 0x92, 0x07, 0x24, 0x43, 0x31, 0x19, 0x0C, 0x9C, 0xAA,
+    0xB9, 0xC0, 0xA1, 0xA1, 0x90, 0x88, 0x09, 0x18, 0x10, 0x08, 0x80, 0xA8, 0xA1, 0x81, 0x00, 0x49,
+    0x6B, 0x4A, 0x48, 0x36, 0x36, 0x14, 0x84, 0xC3, 0xD3, 0xB1, 0xB8, 0x9B, 0x1F, 0x4C, 0x4A, 0x38,
+    0x22, 0x14, 0x93, 0xB1, 0xE9, 0xBD, 0xAB, 0x99, 0x10, 0x43, 0x44, 0x33, 0x12, 0x80, 0x99, 0x9A,
+    0x9C, 0x1C, 0x1A, 0x0A, 0x88, 0xA0, 0x91, 0x10, 0x49, 0x3A, 0x09, 0xD2, 0xE7, 0xD5, 0xA3, 0x91,
+    0x19, 0x3C, 0x5B, 0x2B, 0x19, 0x88, 0x92, 0x91, 0x80, 0x08, 0x1A, 0x08, 0x01, 0x81, 0x82, 0x89,
+    0x0C, 0x0C, 0x89, 0x84, 0x07, 0x84, 0x03, 0x80, 0x89, 0x2D, 0x1B, 0x99, 0xA1, 0xE3, 0x94, 0x13,
+    0x71, 0x48, 0x19, 0xD9, 0xE8, 0xC0, 0xB1, 0x90, 0x18, 0x59, 0x3A, 0x21, 0x13, 0x85, 0xA1, 0x9C,
+    0x1F, 0x2C, 0x1B, 0x98, 0xF1, 0xC5, 0xB3, 0x81, 0x18, 0x3C, 0x5B, 0x2B, 0x19, 0x81, 0x91, 0x91,
+    0x89, 0x09, 0x18, 0x01, 0x04, 0x84, 0x85, 0x82, 0x02, 0x01, 0x08, 0x8B, 0x9D, 0x9C, 0x8B, 0x18,
+    0x41, 0x34, 0x03, 0xF3, 0xD2, 0xE8, 0xB9, 0xB9, 0xA9, 0x89, 0x01, 0x31, 0x53, 0x43, 0x38, 0x2D,
+    0x1F, 0x8C, 0x9A, 0x8A, 0x01, 0x13, 0x15, 0x93, 0xF2, 0xC1, 0xC9, 0x9B, 0x9D, 0x8C, 0x1A, 0x09,
+    0x13, 0x04, 0x84, 0x91, 0xA9, 0x8C, 0x0B, 0x3A, 0xD0, 0xB4, 0x49, 0x00, 0xD6, 0x49, 0x00, 0x46,
+    0x45, 0x32, 0x30, 0x18, 0x99, 0xB9, 0xF1, 0xB1, 0xB2, 0x8A, 0x1D, 0x3D, 0x4B, 0x48, 0x32, 0x04,
+    0x83, 0xB2, 0xEA, 0xBC, 0xAC, 0x89, 0x20, 0x42, 0x34, 0x23, 0x82, 0xB1, 0xE9, 0xBB, 0xAD, 0x8B,
+    0x0B, 0x38, 0x52, 0x35, 0x23, 0x02, 0x88, 0xBC, 0xDD, 0xBA, 0xB8, 0x98, 0x11, 0x41, 0x40, 0x30,
+    0x39, 0x18, 0xA9, 0xD9, 0xB0, 0xC2, 0x85, 0x06, 0x13, 0x12, 0x80, 0x99, 0x99, 0x18, 0x31, 0x62,
+    0x41, 0x2A, 0x2F, 0x1C, 0x8B, 0xB9, 0xD1, 0xC3, 0xB5, 0x83, 0x12, 0x41, 0x39, 0x3B, 0x2E, 0x8B,
+    0xAA, 0x98, 0x82, 0x04, 0x23, 0x02, 0x88, 0xBC, 0x9C, 0x1B, 0x4A, 0x48, 0x01, 0xC2, 0xF4, 0xC4,
+    0xB2, 0x92, 0x10, 0x38, 0x59, 0x38, 0x21, 0x12, 0x91, 0xBA, 0xDF, 0xBD, 0xBB, 0x99, 0x11, 0x44,
+    0x43, 0x33, 0x31, 0x00, 0x8A, 0xC9, 0xC8, 0xB0, 0xB2, 0x90, 0x28, 0x4A, 0x4A, 0x31, 0x14, 0x84,
+    0x91, 0x9C, 0x8F, 0x0C, 0x2B, 0x08, 0x91, 0x95, 0xA3, 0x11, 0x49, 0x3B, 0x1C, 0xDB, 0xF9, 0xC0,
+    0xB1, 0x91, 0x10, 0x38, 0x59, 0x38, 0x20, 0x01, 0x92, 0xA9, 0xCB, 0xCD, 0xA9, 0xA4, 0x87, 0x04,
+    0x03, 0x01, 0x8B, 0x9C, 0x8C, 0x19, 0x51, 0x54, 0x43, 0x21, 0x28, 0x0B, 0x8C, 0xAB, 0xDA, 0xB8,
+    0xB1, 0xA3, 0x93, 0x94, 0x12, 0x14, 0x12, 0x11, 0x88, 0xAB, 0xBE, 0xCC, 0x8A, 0x48, 0x71, 0x63,
+    0x24, 0x13, 0xA1, 0xC0, 0xBA, 0x99, 0x18, 0x50, 0x31, 0x10, 0x98, 0xC0, 0xC8, 0x90, 0x19, 0x4A,
+    0x29, 0x21, 0x96, 0xC4, 0xB1, 0x9C, 0x0F, 0x3C, 0x5B, 0x28, 0x01, 0x85, 0x92, 0x82, 0x08, 0x0B,
+    0x1D, 0x9A, 0xBA, 0xC0, 0xD1, 0xA1, 0xA3, 0x93, 0x83, 0x34, 0x62, 0x41, 0x28, 0x0B, 0xAE, 0xCB,
+    0xBB, 0x9A, 0x19, 0x58, 0x31, 0x21, 0x90, 0xD8, 0xBA, 0x98, 0x00, 0x33, 0x52, 0x29, 0x60, 0xB5,
+    0x45, 0xE0, 0x63, 0x4B, 0x00, 0x8C, 0xA9, 0xA4, 0x96, 0x85, 0x03, 0x20, 0x3A, 0x3D, 0x1A, 0xE9,
+    0xF1, 0xC3, 0xB5, 0x81, 0x18, 0x5B, 0x3C, 0x1A, 0x89, 0xC0, 0xB1, 0xB1, 0x90, 0x18, 0x29, 0x08,
+    0x90, 0xA1, 0x91, 0x28, 0x6B, 0x5C, 0x28, 0x14, 0x86, 0xB5, 0xC2, 0xC1, 0x99, 0x9B, 0x0C, 0x3B,
+    0x4A, 0x48, 0x31, 0x03, 0xB4, 0xC2, 0xC3, 0x94, 0x12, 0x42, 0x30, 0x2C, 0x8E, 0xBB, 0xDB, 0xB8,
+    0x92, 0x85, 0x13, 0x21, 0x38, 0x4B, 0x2D, 0x2B, 0x19, 0x08, 0x91, 0x92, 0x83, 0x04, 0x13, 0x12,
+    0x91, 0xA0, 0x98, 0x19, 0x49, 0x58, 0x10, 0xC2, 0xF2, 0xC1, 0xB0, 0x8C, 0x1F, 0x5E, 0x2B, 0x2A,
+    0x88, 0xB0, 0xD2, 0xA0, 0xA9, 0x8A, 0x19, 0x21, 0x37, 0x45, 0x32, 0x21, 0x09, 0x8B, 0x9C, 0x8A,
+    0x1A, 0x38, 0x10, 0xB3, 0xF4, 0xE3, 0xA4, 0x92, 0x00, 0x38, 0x49, 0x38, 0x20, 0x01, 0x91, 0xB9,
+    0xBD, 0xCD, 0xBC, 0xBA, 0xAA, 0xA8, 0x10, 0x32, 0x75, 0x33, 0x33, 0x22, 0x21, 0x00, 0x98, 0x99,
+    0x99, 0x99, 0x01, 0x21, 0x33, 0x41, 0x09, 0xCC, 0xFF, 0xEC, 0xAB, 0x8C, 0x1B, 0x39, 0x41, 0x13,
+    0x86, 0xA4, 0xD2, 0xB0, 0x99, 0x8B, 0x1C, 0x2B, 0x39, 0x48, 0x21, 0x22, 0x10, 0x01, 0x89, 0x99,
+    0x9A, 0x8B, 0x08, 0x24, 0x27, 0x16, 0x92, 0xC1, 0xEA, 0xDC, 0xBB, 0xC9, 0x91, 0x85, 0x03, 0x21,
+    0x49, 0x3C, 0x4B, 0x3A, 0x11, 0x13, 0x85, 0xB2, 0xD1, 0xC8, 0xB9, 0xA8, 0x99, 0x08, 0x00, 0x21,
+    0x82, 0x02, 0x80, 0x9B, 0x8F, 0x0E, 0x1A, 0x89, 0x02, 0x93, 0x94, 0x11, 0x28, 0x1A, 0x0D, 0x9A,
+    0xFA, 0xA9, 0x81, 0x62, 0x55, 0x53, 0x43, 0x30, 0x2B, 0x0D, 0x8B, 0xB9, 0xD1, 0xC5, 0xA3, 0xA2,
+    0x89, 0x0B, 0x1D, 0x0A, 0x99, 0xB0, 0x91, 0x21, 0x78, 0x70, 0x29, 0x08, 0xA8, 0xB0, 0xB0, 0x90,
+    0x10, 0x59, 0x38, 0x20, 0x70, 0xBC, 0x47, 0x80, 0x44, 0x4D, 0x00, 0xE0, 0xB1, 0x99, 0x0B, 0x3C,
+    0x48, 0x34, 0x17, 0x84, 0x93, 0x91, 0x89, 0x8B, 0x1D, 0x0B, 0x0A, 0x89, 0x01, 0x83, 0x85, 0xA4,
+    0x92, 0x10, 0x59, 0x3B, 0x1D, 0xDA, 0xF9, 0xC1, 0xB1, 0x90, 0x18, 0x3A, 0x59, 0x31, 0x26, 0x14,
+    0x93, 0xB1, 0xD8, 0xCC, 0xAC, 0x8A, 0x1A, 0x38, 0x51, 0x23, 0x13, 0x83, 0x93, 0x94, 0x03, 0x11,
+    0x08, 0x8C, 0xCD, 0xCC, 0xCA, 0xB9, 0xA1, 0x93, 0x04, 0x34, 0x62, 0x41, 0x29, 0x0B, 0x9D, 0xBB,
+    0xCB, 0xB9, 0x93, 0x06, 0x03, 0x21, 0x19, 0x0C, 0x8C, 0xA9, 0xA0, 0xB3, 0x04, 0x42, 0x71, 0x58,
+    0x29, 0x19, 0x88, 0xB8, 0xD1, 0xA0, 0xA1, 0x91, 0x08, 0x3A, 0x5E, 0x4C, 0x2C, 0x0A, 0xA9, 0xC0,
+    0xC0, 0x81, 0x11, 0x30, 0x58, 0x19, 0x9A, 0xCB, 0xB9, 0x95, 0x17, 0x44, 0x43, 0x00, 0x89, 0xCD,
+    0xAA, 0x9A, 0x10, 0x33, 0x45, 0x12, 0x82, 0xB0, 0xC9, 0xAA, 0x9B, 0x8C, 0x1B, 0x1A, 0x19, 0x81,
+    0x81, 0x90, 0x99, 0x8B, 0x8A, 0x23, 0x67, 0x57, 0x32, 0x21, 0x1A, 0x9B, 0x9C, 0x89, 0x11, 0x23,
+    0x15, 0xA1, 0xF8, 0xDA, 0xAC, 0x9A, 0x0A, 0x39, 0x51, 0x23, 0x24, 0x04, 0x92, 0xA0, 0xBA, 0xDC,
+    0xAB, 0xAA, 0x91, 0x13, 0x16, 0x02, 0x92, 0xB8, 0x99, 0x29, 0x7B, 0x6B, 0x2B, 0x1C, 0xAA, 0xB9,
+    0xC0, 0x93, 0x05, 0x35, 0x52, 0x22, 0x10, 0x88, 0xA9, 0x88, 0x00, 0x12, 0x10, 0x99, 0xCD, 0xDE,
+    0xBB, 0xAA, 0x98, 0x80, 0x12, 0x10, 0x19, 0x0B, 0x09, 0xA2, 0xB7, 0xB6, 0x02, 0x50, 0x79, 0x4C,
+    0x3B, 0x18, 0x90, 0xC4, 0xC3, 0xA2, 0x98, 0x0C, 0x1C, 0x1A, 0x08, 0x80, 0x91, 0x80, 0x80, 0x09,
+    0x89, 0x00, 0x14, 0x05, 0x03, 0x92, 0xB0, 0xA8, 0x09, 0x68, 0x60, 0x41, 0x40, 0x39, 0x3C, 0x1D,
+    0x8C, 0xBB, 0xFA, 0xCA, 0xA1, 0x83, 0x27, 0x33, 0x43, 0x10, 0x40, 0x32, 0x4B, 0x20, 0x45, 0x45,
+    0x00, 0xFE, 0xDB, 0xBA, 0xA1, 0x94, 0x14, 0x32, 0x50, 0x38, 0x39, 0x08, 0xA0, 0xD0, 0xB1, 0xA9,
+    0x0B, 0x5E, 0x3B, 0x3B, 0x1A, 0x99, 0xA2, 0x82, 0x15, 0x23, 0x13, 0xA4, 0xE2, 0xD2, 0xA8, 0x9C,
+    0x0D, 0x3B, 0x5B, 0x29, 0x21, 0x04, 0x94, 0xA3, 0xB2, 0xC1, 0xB9, 0xAB, 0xAE, 0x0B, 0x0A, 0x29,
+    0x01, 0x85, 0x83, 0x93, 0x81, 0x89, 0x0A, 0x08, 0x10, 0x33, 0x12, 0xAA, 0xFF, 0xCE, 0x8A, 0x48,
+    0x71, 0x44, 0x33, 0x10, 0x99, 0xBB, 0xDC, 0xBA, 0xA0, 0x93, 0x15, 0x32, 0x52, 0x31, 0x39, 0x1B,
+    0x9C, 0xCC, 0xCA, 0xB8, 0xB2, 0x94, 0x13, 0x42, 0x49, 0x4C, 0x2C, 0x0B, 0xA8, 0xC0, 0xB1, 0x91,
+    0x08, 0x39, 0x59, 0x31, 0x34, 0x06, 0x83, 0xC2, 0xC0, 0xB8, 0xB9, 0x98, 0x30, 0x61, 0x30, 0x19,
+    0xAC, 0xCE, 0xBB, 0xAB, 0x1A, 0x59, 0x31, 0x22, 0x86, 0xB3, 0xD4, 0xB1, 0x90, 0x80, 0x19, 0x28,
+    0x30, 0x31, 0x31, 0x49, 0x2D, 0x0E, 0x8B, 0xBA, 0xD8, 0xB0, 0xB1, 0xC0, 0xA9, 0xA9, 0x09, 0x32,
+    0x76, 0x46, 0x22, 0x01, 0xA9, 0xCB, 0xBC, 0x9B, 0x19, 0x50, 0x31, 0x21, 0x91, 0xB0, 0xD8, 0xB9,
+    0x8B, 0x1A, 0x19, 0x04, 0x87, 0xA6, 0x92, 0x20, 0x5A, 0x5B, 0x2C, 0x19, 0x81, 0xC4, 0xB3, 0xB2,
+    0xA8, 0x8C, 0x1C, 0x3A, 0x48, 0x30, 0x41, 0x21, 0x19, 0x09, 0x89, 0x91, 0x95, 0x94, 0x03, 0x11,
+    0x49, 0x2C, 0x8B, 0xCC, 0xF9, 0xC0, 0xB1, 0x91, 0x10, 0x40, 0x48, 0x29, 0x19, 0x8B, 0xA8, 0x84,
+    0x07, 0x24, 0x13, 0x91, 0xEB, 0xCC, 0xBC, 0x99, 0x11, 0x44, 0x33, 0x42, 0x19, 0x8B, 0x9D, 0x9A,
+    0x89, 0x80, 0x00, 0x11, 0x11, 0x18, 0x08, 0xB9, 0xE9, 0xE8, 0xA0, 0xB2, 0x85, 0x15, 0x13, 0x04,
+    0x91, 0xA1, 0xA9, 0x2A, 0x7C, 0x6C, 0x2B, 0x0A, 0x99, 0xB0, 0xC0, 0x91, 0x01, 0x20, 0x50, 0x2A
+};
+
+const WAVEFORM waveLibrary[] =
+{
+    {"chirp", 4096, wave0},
+    {"qpskburst", 4096, wave1},
+};
+
+const uint8_t waveCount = 2;
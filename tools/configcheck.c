@@ -0,0 +1,190 @@
+// Configuration Record Checker (host)
+//
+// Confirms source/config.c against a stubbed EEPROM: random configurations
+// survive packConfig/unpackConfig and saveConfig/loadConfig field for field,
+// the record fits CONFIG_MAX_WORDS, and loadConfig refuses (leaving the
+// configuration untouched) a flipped bit anywhere in the record, another
+// version, a cleared record and an out of range payload length.
+//
+// Build and run from the repository root:
+//   gcc -O2 -I source -o configcheck tools/configcheck.c source/config.c
+//   ./configcheck
+// Exit status is non-zero on any mismatch.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "inc/config.h"
+#include "inc/eeprom.h"
+
+#define ROUNDS 1000
+
+// EEPROM stub
+static uint32_t eeprom[EEPROM_WORDS];
+
+bool initEeprom(void)
+{
+    return true;
+}
+
+uint32_t readEeprom(uint16_t add)
+{
+    return eeprom[add];
+}
+
+void writeEeprom(uint16_t add, uint32_t data)
+{
+    eeprom[add] = data;
+}
+
+static uint32_t random32(void)
+{
+    return ((uint32_t) rand() << 16) ^ (uint32_t) rand();
+}
+
+static float randomFloat(float lo, float hi)
+{
+    return lo + (hi - lo) * rand() / (float) RAND_MAX;
+}
+
+static void randomConfig(CONFIG* cfg)
+{
+    uint8_t i;
+    memset(cfg, 0, sizeof(*cfg));
+    cfg->mode = rand() % 11;
+    cfg->filter = rand() & 1;
+    cfg->tone = rand() & 1;
+    cfg->differential = rand() & 1;
+    cfg->sampleRate = randomFloat(1000, 200000);
+    cfg->freqI = (int32_t) random32() % 100000;
+    cfg->freqQ = (int32_t) random32() % 100000;
+    cfg->rawI = rand() % 4096;
+    cfg->rawQ = rand() % 4096;
+    for (i = 0; i < 2; i++)
+    {
+        cfg->ch[i].gain = rand() % (2 * Q15_ONE);
+        cfg->ch[i].phase = random32();
+        cfg->ch[i].offset = rand() % 401 - 200;
+    }
+    cfg->scheme = rand() % 8;
+    cfg->sps = 1 + rand() % 16;
+    cfg->payloadLength = rand() % (PAYLOAD_MAX + 1);
+    for (i = 0; i < PAYLOAD_MAX; i++)
+        cfg->payload[i] = i < cfg->payloadLength ? 32 + rand() % 95 : 0;
+    cfg->fskType = rand() % 3;
+    cfg->fskParam = randomFloat(0.2f, 1.0f);
+    cfg->prbsSource = rand() & 1;
+    cfg->prbsOrder = 7 + rand() % 25;
+    cfg->prbsSeed = random32();
+    cfg->prbsErrors = random32();
+    cfg->fecRate = rand() % 4;
+    cfg->scrambler = rand() % 3;
+}
+
+// Field by field, floats by bit pattern
+static bool sameConfig(const CONFIG* a, const CONFIG* b)
+{
+    uint8_t i;
+    bool same = a->mode == b->mode && a->filter == b->filter && a->tone == b->tone
+             && a->differential == b->differential
+             && memcmp(&a->sampleRate, &b->sampleRate, sizeof(float)) == 0
+             && a->freqI == b->freqI && a->freqQ == b->freqQ
+             && a->rawI == b->rawI && a->rawQ == b->rawQ
+             && a->scheme == b->scheme && a->sps == b->sps
+             && a->payloadLength == b->payloadLength
+             && memcmp(a->payload, b->payload, PAYLOAD_MAX) == 0
+             && a->fskType == b->fskType
+             && memcmp(&a->fskParam, &b->fskParam, sizeof(float)) == 0
+             && a->prbsSource == b->prbsSource && a->prbsOrder == b->prbsOrder
+             && a->prbsSeed == b->prbsSeed && a->prbsErrors == b->prbsErrors
+             && a->fecRate == b->fecRate && a->scrambler == b->scrambler;
+    for (i = 0; i < 2; i++)
+        same = same && a->ch[i].gain == b->ch[i].gain && a->ch[i].phase == b->ch[i].phase
+            && a->ch[i].offset == b->ch[i].offset;
+    return same;
+}
+
+// Load must fail and leave the sentinel configuration untouched
+static int refused(const CONFIG* sentinel)
+{
+    CONFIG cfg = *sentinel;
+    if (loadConfig(&cfg))
+        return 1;
+    return !sameConfig(&cfg, sentinel);
+}
+
+static int checkRoundTrip(void)
+{
+    uint32_t words[CONFIG_MAX_WORDS];
+    CONFIG a, b;
+    uint16_t n = 0;
+    int i, bad = 0;
+    for (i = 0; i < ROUNDS; i++)
+    {
+        randomConfig(&a);
+        memset(&b, 0, sizeof(b));
+        n = packConfig(&a, words);
+        bad += !unpackConfig(&b, words, n) || !sameConfig(&a, &b);
+        bad += unpackConfig(&b, words, n - 1);
+    }
+    printf("pack/unpack:  %u payload words, %s\n", n, bad ? "FAIL" : "ok");
+    return bad != 0;
+}
+
+static int checkEeprom(void)
+{
+    uint32_t words[CONFIG_MAX_WORDS];
+    CONFIG a, b, sentinel;
+    uint16_t n, add;
+    int i, bad = 0, corrupt = 0;
+    randomConfig(&sentinel);
+    for (i = 0; i < ROUNDS; i++)
+    {
+        randomConfig(&a);
+        memset(eeprom, 0xFF, sizeof(eeprom));
+        saveConfig(&a);
+        memset(&b, 0, sizeof(b));
+        bad += !loadConfig(&b) || !sameConfig(&a, &b);
+    }
+
+    // Record length: header, payload and crc within CONFIG_MAX_WORDS
+    n = packConfig(&a, words) + 4;
+    bad += n > CONFIG_MAX_WORDS;
+
+    // Every single bit flip is refused
+    for (add = 0; add < n; add++)
+        for (i = 0; i < 32; i++)
+        {
+            eeprom[CONFIG_EEPROM_ADD + add] ^= 1u << i;
+            corrupt += refused(&sentinel);
+            eeprom[CONFIG_EEPROM_ADD + add] ^= 1u << i;
+        }
+    bad += !loadConfig(&b);
+
+    // Another version and a cleared record
+    eeprom[CONFIG_EEPROM_ADD + 1]++;
+    corrupt += refused(&sentinel);
+    eeprom[CONFIG_EEPROM_ADD + 1]--;
+    clearConfig();
+    corrupt += refused(&sentinel);
+
+    // Payload length beyond PAYLOAD_MAX with a valid crc
+    a.payloadLength = PAYLOAD_MAX + 1;
+    saveConfig(&a);
+    corrupt += refused(&sentinel);
+
+    printf("save/load:    %u record words, %s\n", n, bad ? "FAIL" : "ok");
+    printf("corruption:   %s\n", corrupt ? "FAIL" : "ok");
+    return bad != 0 || corrupt != 0;
+}
+
+int main(void)
+{
+    int fail = 0;
+    srand(1);
+    fail |= checkRoundTrip();
+    fail |= checkEeprom();
+    return fail;
+}
@@ -0,0 +1,127 @@
+// FEC Reference Checker (host)
+//
+// Confirms source/fec.c (byte tables, puncturing and scramblers) against
+// a plain bit serial reference encoder for every rate and scrambler, then
+// measures host throughput.
+//
+// Build and run from the repository root:
+//   gcc -O2 -I source -o feccheck tools/feccheck.c source/fec.c source/tables.c
+//   ./feccheck
+// Exit status is non-zero on any mismatch.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include "inc/fec.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HOST_CYCLES() __rdtsc()
+#endif
+
+#define BYTES 12000                     // multiple of 3 and 4
+
+static uint8_t data[BYTES];
+static uint32_t dataIndex;
+
+static uint32_t source(void)
+{
+    uint32_t w = ((uint32_t) data[dataIndex] << 24) | (data[dataIndex + 1] << 16)
+               | (data[dataIndex + 2] << 8) | data[dataIndex + 3];
+    dataIndex = (dataIndex + 4) % BYTES;
+    return w;
+}
+
+// Reference: one bit at a time, straight from the definitions
+static int reference(FEC_RATE rate, SCRAMBLER scrambler, uint8_t* out)
+{
+    static const uint8_t keep23[4] = {1, 1, 1, 0};
+    static const uint8_t keep34[6] = {1, 1, 1, 0, 0, 1};
+    uint32_t sr = 0, add = 0x7F, mult = 0x7FFFFF, x, y, a, b;
+    int n = 0, i, k = 0;
+    for (i = 0; i < BYTES * 8; i++)
+    {
+        x = (data[i / 8] >> (7 - i % 8)) & 1;
+        if (scrambler == SCRAMBLE_ADDITIVE)
+        {
+            y = ((add >> 3) ^ (add >> 6)) & 1;
+            add = ((add << 1) | y) & 0x7F;
+            x ^= y;
+        }
+        else if (scrambler == SCRAMBLE_MULTIPLICATIVE)
+        {
+            x ^= ((mult >> 17) ^ (mult >> 22)) & 1;
+            mult = ((mult << 1) | x) & 0x7FFFFF;
+        }
+        if (rate == FEC_OFF)
+        {
+            out[n++] = x;
+            continue;
+        }
+        // 171 / 133 octal, taps counted from the current input bit
+        sr = ((sr << 1) | x) & 0x7F;
+        a = ((sr >> 0) ^ (sr >> 1) ^ (sr >> 2) ^ (sr >> 3) ^ (sr >> 6)) & 1;
+        b = ((sr >> 0) ^ (sr >> 2) ^ (sr >> 3) ^ (sr >> 5) ^ (sr >> 6)) & 1;
+        if (rate == FEC_1_2 || (rate == FEC_2_3 ? keep23[k % 4] : keep34[k % 6]))
+            out[n++] = a;
+        k++;
+        if (rate == FEC_1_2 || (rate == FEC_2_3 ? keep23[k % 4] : keep34[k % 6]))
+            out[n++] = b;
+        k++;
+    }
+    return n;
+}
+
+static const char* rateNames[] = {"none", "1/2", "2/3", "3/4"};
+static const char* scramblerNames[] = {"none", "additive", "multiplicative"};
+
+int main(void)
+{
+    static uint8_t ref[BYTES * 16];
+    int r, s, n, i, bad, fail = 0;
+    uint32_t w = 0;
+    clock_t start;
+    double seconds;
+#ifdef HOST_CYCLES
+    uint64_t cycles;
+#endif
+
+    srand(1);
+    for (i = 0; i < BYTES; i++)
+        data[i] = rand();
+
+    for (r = FEC_OFF; r <= FEC_3_4; r++)
+        for (s = SCRAMBLE_OFF; s <= SCRAMBLE_MULTIPLICATIVE; s++)
+        {
+            setFecRate(r);
+            setScrambler(s);
+            dataIndex = 0;
+            n = reference(r, s, ref);
+            bad = 0;
+            for (i = 0; i < n; i++)
+            {
+                if (i % 32 == 0)
+                    w = nextFecWord(source);
+                bad += ((w >> (31 - i % 32)) & 1) != ref[i];
+            }
+            printf("rate %-4s scrambler %-14s %6d bits, %s\n", rateNames[r], scramblerNames[s], n,
+                   bad ? "FAIL" : "ok");
+            fail |= bad != 0;
+        }
+
+    // Throughput, rate 1/2 with the additive scrambler
+    setFecRate(FEC_1_2);
+    setScrambler(SCRAMBLE_ADDITIVE);
+    start = clock();
+#ifdef HOST_CYCLES
+    cycles = HOST_CYCLES();
+#endif
+    for (i = 0; i < 20000000; i++)
+        w ^= nextFecWord(source);
+    seconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+    printf("host: %.1f Mbit/s in (%08X)\n", 20000000.0 * 16 / seconds / 1e6, w);
+#ifdef HOST_CYCLES
+    printf("host: %.3f bits in per TSC cycle\n", 20000000.0 * 16 / (HOST_CYCLES() - cycles));
+#endif
+    return fail;
+}
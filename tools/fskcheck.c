@@ -0,0 +1,241 @@
+// FSK Reference Checker (host)
+//
+// Runs the table driven FSK of source/fsk.c (CPFSK, MSK and GMSK over
+// several sps) against double precision models fed with the same bits,
+// which integrate the frequency pulse straight into the phase with the
+// delay of the firmware span. Per case it reports
+//   - the phase error of the DAC rail samples (atan2 of I, Q) against the
+//     model truncated to the firmware span, RMS and worst case: the fixed
+//     point loss of the table, the accumulator and the sine lookup
+//   - the Welch PSD (Hann, 50 % overlap) against the ideal model (8 symbols
+//     of Gaussian) as the largest difference in dB over the bins within
+//     PSD_RANGE of the peak: adds the loss of the truncated GMSK pulse
+//   - the 99 % occupied bandwidth of both in multiples of the symbol rate
+// The bit source is stubbed here so the firmware and the model see the
+// same random bits.
+//
+// Build and run from the repository root:
+//   gcc -O2 -I source -o fskcheck tools/fskcheck.c source/fsk.c source/tables.c -lm
+//   ./fskcheck
+// Exit status is non-zero if any case exceeds the limits below.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include "inc/fsk.h"
+#include "inc/modulator.h"
+
+#define GAIN          2047              // rail amplitude in DAC LSb
+#define SAMPLES       65536
+#define NFFT          512
+#define REF_SPAN      8                 // symbols of the model pulse
+#define PSD_RANGE     40.0              // dB below the peak compared
+#define PHASE_RMS_MAX 0.002             // rad
+#define PHASE_MAX     0.005             // rad
+#define PSD_DIFF_MAX  1.0               // dB
+#define OBW_DIFF_MAX  0.02              // relative
+
+typedef struct _CASE
+{
+    FSK_TYPE type;
+    float param;
+    uint8_t sps;
+    const char* name;
+} CASE;
+
+static const CASE cases[] =
+{
+    {CPFSK, 0.5f, 4, "cpfsk h=0.5"}, {CPFSK, 0.5f, 16, "cpfsk h=0.5"},
+    {CPFSK, 1.0f, 8, "cpfsk h=1.0"}, {CPFSK, 0.35f, 8, "cpfsk h=0.35"},
+    {MSK, 0, 4, "msk"}, {MSK, 0, 8, "msk"},
+    {GMSK, 0.5f, 8, "gmsk bt=0.5"}, {GMSK, 0.3f, 4, "gmsk bt=0.3"},
+    {GMSK, 0.3f, 8, "gmsk bt=0.3"}, {GMSK, 0.25f, 16, "gmsk bt=0.25"},
+};
+
+static uint8_t bits[SAMPLES / 4 + REF_SPAN];
+static uint32_t bitCount;
+static double fixedI[SAMPLES], fixedQ[SAMPLES], tableI[SAMPLES], tableQ[SAMPLES];
+static double refI[SAMPLES], refQ[SAMPLES];
+static double psdFixed[NFFT], psdRef[NFFT];
+
+// Bit source stub for fsk.c
+uint32_t nextSourceBits(uint8_t n)
+{
+    uint32_t b = 0;
+    while (n--)
+        b = (b << 1) | bits[bitCount++];
+    return b;
+}
+
+static double gaussianPulse(double t, double bt)
+{
+    double k = 2 * M_PI * bt / sqrt(2 * log(2));
+    return 0.5 * (erf(k * (t + 0.5)) - erf(k * (t - 0.5)));
+}
+
+static double modelPulse(const CASE* c, double t)
+{
+    if (c->type == GMSK)
+        return gaussianPulse(t, c->param);
+    return (t >= -0.5 && t < 0.5) ? 1 : 0;
+}
+
+// Phase of every sample from the same bits, delay as the firmware span,
+// pulse cut to that span (truncate) or REF_SPAN symbols
+static void runModel(const CASE* c, bool truncate, double* sI, double* sQ)
+{
+    double h = (c->type == CPFSK) ? c->param : 0.5;
+    double delay = (c->type == GMSK) ? ((c->param < 0.3f) ? 4 : (c->param < 0.5f) ? 3 : 2) / 2.0 : 0.5;
+    double limit = truncate ? delay : REF_SPAN, sum = 0, phase = 0, f, t;
+    int32_t i, j, m, symbols = SAMPLES / c->sps;
+
+    for (i = -REF_SPAN * c->sps; i < REF_SPAN * c->sps; i++)
+        if (fabs((i + 0.5) / c->sps) < limit)
+            sum += modelPulse(c, (i + 0.5) / c->sps);
+
+    // Symbol m starts at sample m*sps, centred delay symbols later. Symbols
+    // before the start are 0 as in the reset history of the firmware.
+    for (j = 0; j < SAMPLES; j++)
+    {
+        f = 0;
+        for (m = j / c->sps - REF_SPAN; m <= j / c->sps + REF_SPAN && m < symbols; m++)
+        {
+            t = (j - m * c->sps + 0.5) / c->sps - delay;
+            if (fabs(t) < limit)
+                f += (m >= 0 && bits[m] ? 1 : -1) * modelPulse(c, t);
+        }
+        phase += f / sum * h * M_PI;
+        sI[j] = GAIN * cos(phase);
+        sQ[j] = GAIN * sin(phase);
+    }
+}
+
+// In place radix-2 FFT
+static void fft(double* re, double* im, int n)
+{
+    int i, j, k, len;
+    double a, wr, wi, tr, ti, ur, ui;
+    for (i = 1, j = 0; i < n; i++)
+    {
+        for (k = n >> 1; j & k; k >>= 1)
+            j ^= k;
+        j ^= k;
+        if (i < j)
+        {
+            tr = re[i]; re[i] = re[j]; re[j] = tr;
+            ti = im[i]; im[i] = im[j]; im[j] = ti;
+        }
+    }
+    for (len = 2; len <= n; len <<= 1)
+        for (i = 0; i < n; i += len)
+            for (k = 0; k < len / 2; k++)
+            {
+                a = -2 * M_PI * k / len;
+                wr = cos(a);
+                wi = sin(a);
+                ur = re[i + k];
+                ui = im[i + k];
+                tr = re[i + k + len / 2] * wr - im[i + k + len / 2] * wi;
+                ti = re[i + k + len / 2] * wi + im[i + k + len / 2] * wr;
+                re[i + k] = ur + tr;
+                im[i + k] = ui + ti;
+                re[i + k + len / 2] = ur - tr;
+                im[i + k + len / 2] = ui - ti;
+            }
+}
+
+// Welch PSD, bins reordered to -fs/2..fs/2
+static void welch(const double* sI, const double* sQ, double* psd)
+{
+    double re[NFFT], im[NFFT], w;
+    int start, i;
+    for (i = 0; i < NFFT; i++)
+        psd[i] = 0;
+    for (start = 0; start + NFFT <= SAMPLES; start += NFFT / 2)
+    {
+        for (i = 0; i < NFFT; i++)
+        {
+            w = 0.5 - 0.5 * cos(2 * M_PI * i / NFFT);
+            re[i] = sI[start + i] * w;
+            im[i] = sQ[start + i] * w;
+        }
+        fft(re, im, NFFT);
+        for (i = 0; i < NFFT; i++)
+            psd[(i + NFFT / 2) % NFFT] += re[i] * re[i] + im[i] * im[i];
+    }
+}
+
+// 99 % occupied bandwidth in bins
+static double occupiedBandwidth(const double* psd)
+{
+    double total = 0, low = 0, high = 0;
+    int a = 0, b = NFFT - 1, i;
+    for (i = 0; i < NFFT; i++)
+        total += psd[i];
+    while (low + psd[a] < 0.005 * total)
+        low += psd[a++];
+    while (high + psd[b] < 0.005 * total)
+        high += psd[b--];
+    return b - a + 1;
+}
+
+static int checkCase(const CASE* c)
+{
+    double err, sum = 0, worst = 0, peak = 0, diff = 0, obwFixed, obwRef;
+    int32_t sI, sQ;
+    int j, fail;
+
+    bitCount = 0;
+    setFsk(c->type, c->param, c->sps, GAIN, GAIN);
+    for (j = 0; j < SAMPLES; j++)
+    {
+        fskSample(&sI, &sQ);
+        fixedI[j] = sI;
+        fixedQ[j] = sQ;
+    }
+    runModel(c, true, tableI, tableQ);
+    runModel(c, false, refI, refQ);
+
+    for (j = 0; j < SAMPLES; j++)
+    {
+        err = remainder(atan2(fixedQ[j], fixedI[j]) - atan2(tableQ[j], tableI[j]), 2 * M_PI);
+        sum += err * err;
+        if (fabs(err) > worst)
+            worst = fabs(err);
+    }
+
+    welch(fixedI, fixedQ, psdFixed);
+    welch(refI, refQ, psdRef);
+    for (j = 0; j < NFFT; j++)
+        if (psdRef[j] > peak)
+            peak = psdRef[j];
+    for (j = 0; j < NFFT; j++)
+        if (10 * log10(psdRef[j] / peak) > -PSD_RANGE)
+        {
+            err = fabs(10 * log10(psdFixed[j] / psdRef[j]));
+            if (err > diff)
+                diff = err;
+        }
+    obwFixed = occupiedBandwidth(psdFixed) * c->sps / NFFT;
+    obwRef = occupiedBandwidth(psdRef) * c->sps / NFFT;
+
+    fail = sqrt(sum / SAMPLES) > PHASE_RMS_MAX || worst > PHASE_MAX || diff > PSD_DIFF_MAX
+        || fabs(obwFixed - obwRef) > OBW_DIFF_MAX * obwRef + (double) c->sps / NFFT;
+    printf("%-13s sps %2u  phase rms %.4f max %.4f rad  psd %.2f dB  obw %.3f / %.3f Rs  %s\n",
+           c->name, c->sps, sqrt(sum / SAMPLES), worst, diff, obwFixed, obwRef, fail ? "FAIL" : "ok");
+    return fail;
+}
+
+int main(void)
+{
+    unsigned i;
+    int fail = 0;
+    srand(1);
+    for (i = 0; i < sizeof(bits); i++)
+        bits[i] = rand() & 1;
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+        fail |= checkCase(&cases[i]);
+    return fail;
+}
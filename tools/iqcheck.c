@@ -0,0 +1,180 @@
+// IQ Correction Checker (host)
+//
+// Confirms the output stage correction of source/output.h and the matrix
+// building of source/iqcal.c against double precision:
+//   - identity correction passes every DAC range sample unchanged
+//   - correctSample of random Q15 matrices and offsets is within 1 LSb of
+//     a*I + b*Q + oI, c*I + d*Q + oQ
+//   - setIqImbalance followed by the modelled imbalanced chain
+//     [1 0; g*sin(p) g*cos(p)] gives back the input (scaled by the
+//     normalization), reported as the image rejection of a tone
+//   - save/load through EEPROM (stubbed here) restores the same words and
+//     a corrupted record is refused
+//
+// Build and run from the repository root:
+//   gcc -O2 -I source -o iqcheck tools/iqcheck.c source/iqcal.c source/output.c -lm
+//   ./iqcheck
+// Exit status is non-zero on any mismatch.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include "inc/iqcal.h"
+#include "inc/output.h"
+#include "inc/eeprom.h"
+
+#define IRR_MIN 50.0                    // dB, image rejection after correction
+#define TONE    1024                    // samples of the image rejection tone
+
+// EEPROM stub
+static uint32_t eeprom[EEPROM_WORDS];
+
+bool initEeprom(void)
+{
+    return true;
+}
+
+uint32_t readEeprom(uint16_t add)
+{
+    return eeprom[add];
+}
+
+void writeEeprom(uint16_t add, uint32_t data)
+{
+    eeprom[add] = data;
+}
+
+static int32_t randRange(int32_t lo, int32_t hi)
+{
+    return lo + rand() % (hi - lo + 1);
+}
+
+static int checkIdentity(void)
+{
+    const OUTPUT_CORRECTION* corr;
+    int32_t x, sI, sQ;
+    int bad = 0;
+    resetIqCorrection();
+    corr = &getOutputStage()->corr;
+    for (x = -DAC_MAX; x <= DAC_MAX; x++)
+    {
+        sI = x;
+        sQ = -x;
+        correctSample(corr, &sI, &sQ);
+        bad += (sI != x) + (sQ != -x);
+    }
+    printf("identity:          %s\n", bad ? "FAIL" : "ok");
+    return bad != 0;
+}
+
+static int checkMatrix(void)
+{
+    const OUTPUT_CORRECTION* corr;
+    float m[4];
+    int32_t oI, oQ, sI, sQ, xI, xQ;
+    double refI, refQ, err, worst = 0;
+    int i, k;
+    for (k = 0; k < 200; k++)
+    {
+        setIqMatrix(randRange(-32768, 32767) / 32768.0f, randRange(-32768, 32767) / 32768.0f,
+                    randRange(-32768, 32767) / 32768.0f, randRange(-32768, 32767) / 32768.0f,
+                    randRange(-100, 100), randRange(-100, 100));
+        corr = &getOutputStage()->corr;
+        getIqMatrix(m, &oI, &oQ);
+        for (i = 0; i < 1000; i++)
+        {
+            xI = sI = randRange(-2047, 2047);
+            xQ = sQ = randRange(-2047, 2047);
+            correctSample(corr, &sI, &sQ);
+            refI = m[0] * xI + m[1] * xQ + oI;
+            refQ = m[2] * xI + m[3] * xQ + oQ;
+            err = fmax(fabs(sI - refI), fabs(sQ - refQ));
+            if (err > worst)
+                worst = err;
+        }
+    }
+    printf("matrix:            max error %.3f LSb, %s\n", worst, worst <= 1 ? "ok" : "FAIL");
+    return worst > 1;
+}
+
+// Image rejection of a unit tone through correction and the imbalanced chain
+static double imageRejection(float gainDb, float skewDeg)
+{
+    const OUTPUT_CORRECTION* corr;
+    double g = pow(10, gainDb / 20.0), p = skewDeg * M_PI / 180;
+    double wanted[2] = {0, 0}, image[2] = {0, 0}, yI, yQ, a;
+    int32_t sI, sQ;
+    int n;
+    setIqImbalance(gainDb, skewDeg, 0, 0);
+    corr = &getOutputStage()->corr;
+    for (n = 0; n < TONE; n++)
+    {
+        a = 2 * M_PI * 8 * n / TONE;
+        sI = lround(2000 * cos(a));
+        sQ = lround(2000 * sin(a));
+        correctSample(corr, &sI, &sQ);
+        yI = sI;
+        yQ = g * sin(p) * sI + g * cos(p) * sQ;
+        // Correlate with e^-ja (wanted) and e^+ja (image)
+        wanted[0] += yI * cos(a) + yQ * sin(a);
+        wanted[1] += yQ * cos(a) - yI * sin(a);
+        image[0] += yI * cos(a) - yQ * sin(a);
+        image[1] += yQ * cos(a) + yI * sin(a);
+    }
+    return 10 * log10((wanted[0] * wanted[0] + wanted[1] * wanted[1])
+                      / (image[0] * image[0] + image[1] * image[1] + 1e-9));
+}
+
+static int checkImbalance(void)
+{
+    static const float gains[] = {-1.0f, -0.3f, 0.2f, 1.0f};
+    static const float skews[] = {-5.0f, -1.0f, 0.5f, 3.0f};
+    double irr, worst = 1e9;
+    int i, j;
+    for (i = 0; i < 4; i++)
+        for (j = 0; j < 4; j++)
+        {
+            irr = imageRejection(gains[i], skews[j]);
+            if (irr < worst)
+                worst = irr;
+        }
+    printf("imbalance:         worst image rejection %.1f dB, %s\n", worst, worst >= IRR_MIN ? "ok" : "FAIL");
+    return worst < IRR_MIN;
+}
+
+static int checkEeprom(void)
+{
+    OUTPUT_CORRECTION saved;
+    const OUTPUT_CORRECTION* corr;
+    int bad = 0;
+    setIqMatrix(0.9f, -0.1f, 0.05f, 0.95f, 12, -7);
+    saved = getOutputStage()->corr;
+    saveIqCorrection();
+    resetIqCorrection();
+    bad += !loadIqCorrection();
+    corr = &getOutputStage()->corr;
+    bad += corr->rowI != saved.rowI || corr->rowQ != saved.rowQ
+        || corr->offsetI != saved.offsetI || corr->offsetQ != saved.offsetQ;
+
+    // Corrupted record: refused, the active correction is kept
+    eeprom[IQCAL_EEPROM_ADD + 2] ^= 1;
+    resetIqCorrection();
+    bad += loadIqCorrection();
+    bad += getOutputStage()->corr.rowQ != PACK16(0, 32767);
+    printf("eeprom round trip: %s\n", bad ? "FAIL" : "ok");
+    return bad != 0;
+}
+
+int main(void)
+{
+    int fail = 0;
+    srand(1);
+    initOutputStage();
+    fail |= checkIdentity();
+    fail |= checkMatrix();
+    fail |= checkImbalance();
+    fail |= checkEeprom();
+    return fail;
+}
@@ -0,0 +1,302 @@
+// OFDM Reference Checker (host)
+//
+// Confirms the Q15 IFFT and symbol builder of source/ofdm.c:
+//   - ifftQ15 bit for bit against a scalar model of the same Q15 arithmetic
+//     (halving butterflies, truncating twiddle products, sine table)
+//   - ifftQ15 of random spectra at N = 64, 128 and 256 against a
+//     direct IDFT with the same 1/N scaling, error in Q15 LSb (RMS, worst)
+//     and SNR after undoing the mixed radix digit reversal; points lie
+//     within the Q15 unit circle, the input range ifftQ15 is specified for
+//   - whole symbols from setOfdm/ofdmSample (QPSK and 16-QAM) against the
+//     IDFT of the same mapper points and pilots scaled as the firmware,
+//     worst error in DAC LSb and SNR, and the cyclic prefix equal to the
+//     symbol tail
+//   - host timing of ifftQ15 against the direct IDFT, for relative cost
+//     only (the target figures come from the ofdm bench command)
+//
+// Build and run from the repository root:
+//   gcc -O2 -I source -o ofdmcheck tools/ofdmcheck.c source/ofdm.c source/modulator.c
+//       source/constellation.c source/rrc.c source/prbs.c source/fec.c
+//       source/packet.c source/output.c source/nco.c source/fir.c source/tables.c
+//       -lm   (one line)
+//   ./ofdmcheck
+// Exit status is non-zero on any model mismatch or if any size or symbol
+// exceeds the limits below.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#include "inc/ofdm.h"
+#include "inc/modulator.h"
+#include "inc/dsp.h"
+#include "inc/nco.h"
+
+// Gains as in main.c
+#define I_GAIN ((4095 - 190) / 2)
+#define Q_GAIN ((4095 - 175) / 2)
+
+#define IFFT_ROUNDS   200
+#define IFFT_SNR_MIN  60.0              // dB, random spectra
+#define IFFT_ERR_MAX  4.0               // Q15 LSb
+#define SYMBOL_SNR_MIN 45.0             // dB
+#define BENCH_ROUNDS  2000
+
+static double refI[OFDM_MAX], refQ[OFDM_MAX];
+static uint16_t order[OFDM_MAX];
+
+// Direct IDFT, (1/n) sum X[k] e^(+j 2 pi k t / n)
+static void idft(const double* xI, const double* xQ, uint16_t n)
+{
+    double a, sI, sQ;
+    uint16_t t, k;
+    for (t = 0; t < n; t++)
+    {
+        sI = sQ = 0;
+        for (k = 0; k < n; k++)
+        {
+            a = 2 * M_PI * ((uint32_t) k * t % n) / n;
+            sI += xI[k] * cos(a) - xQ[k] * sin(a);
+            sQ += xI[k] * sin(a) + xQ[k] * cos(a);
+        }
+        refI[t] = sI / n;
+        refQ[t] = sQ / n;
+    }
+}
+
+// Output position -> time index: radix-4 stages while four divides the
+// span, then radix-2, first stage digit most significant in the position
+static void digitReversal(uint16_t n)
+{
+    uint16_t radix[8], stages = 0, pos, rest, span, weight, s;
+    for (span = n; span > 1; span /= radix[stages++])
+        radix[stages] = (span % 4 == 0) ? 4 : 2;
+    for (pos = 0; pos < n; pos++)
+    {
+        rest = pos;
+        span = n;
+        weight = 1;
+        order[pos] = 0;
+        for (s = 0; s < stages; s++)
+        {
+            span /= radix[s];
+            order[pos] += rest / span * weight;
+            rest %= span;
+            weight *= radix[s];
+        }
+    }
+}
+
+// Scalar DIF model: radix-4 stages then radix-2, every butterfly output
+// halved twice (radix-4) or once (radix-2), truncated as the packed ops
+static void modelIfft(int16_t* re, int16_t* im, uint16_t n)
+{
+    int32_t aR, aI, bR, bI, cR, cI, dR, dI, s0R, s0I, s1R, s1I, uR, uI, tR, tI;
+    int32_t yR[4], yI[4], wR, wI;
+    uint32_t phase;
+    uint16_t span, q, g, j, m, e;
+    for (span = n; span >= 4 && span % 4 == 0; span /= 4)
+    {
+        q = span / 4;
+        for (g = 0; g < n; g += span)
+            for (j = 0; j < q; j++)
+            {
+                e = g + j;
+                aR = re[e]; aI = im[e];
+                bR = re[e + q]; bI = im[e + q];
+                cR = re[e + 2 * q]; cI = im[e + 2 * q];
+                dR = re[e + 3 * q]; dI = im[e + 3 * q];
+                s0R = (aR + cR) >> 1; s0I = (aI + cI) >> 1;
+                s1R = (bR + dR) >> 1; s1I = (bI + dI) >> 1;
+                uR = (aR - cR) >> 1; uI = (aI - cI) >> 1;
+                tR = (bR - dR) >> 1; tI = (bI - dI) >> 1;
+                yR[0] = (s0R + s1R) >> 1; yI[0] = (s0I + s1I) >> 1;
+                yR[1] = (uR - tI) >> 1; yI[1] = (uI + tR) >> 1;
+                yR[2] = (s0R - s1R) >> 1; yI[2] = (s0I - s1I) >> 1;
+                yR[3] = (uR + tI) >> 1; yI[3] = (uI - tR) >> 1;
+                for (m = 0; m < 4; m++)
+                {
+                    if (j && m)
+                    {
+                        phase = m * j * (n / span) * (0x80000000u / n) * 2;
+                        wR = ncoCos(phase);
+                        wI = ncoSin(phase);
+                        aR = yR[m] * wR - yI[m] * wI;
+                        aI = yR[m] * wI + yI[m] * wR;
+                        yR[m] = aR >> 15;
+                        yI[m] = aI >> 15;
+                    }
+                    re[e + m * q] = yR[m];
+                    im[e + m * q] = yI[m];
+                }
+            }
+    }
+    if (span == 2)
+        for (g = 0; g < n; g += 2)
+        {
+            aR = re[g]; aI = im[g];
+            re[g] = (aR + re[g + 1]) >> 1; im[g] = (aI + im[g + 1]) >> 1;
+            re[g + 1] = (aR - re[g + 1]) >> 1; im[g + 1] = (aI - im[g + 1]) >> 1;
+        }
+}
+
+static int checkIfft(uint16_t n)
+{
+    uint32_t x[OFDM_MAX];
+    int16_t mR[OFDM_MAX], mI[OFDM_MAX];
+    double xI[OFDM_MAX], xQ[OFDM_MAX], e, err = 0, sig = 0, worst = 0;
+    uint16_t i, r, mismatches = 0;
+    int fail;
+    digitReversal(n);
+    for (r = 0; r < IFFT_ROUNDS; r++)
+    {
+        for (i = 0; i < n; i++)
+        {
+            do
+            {
+                xI[i] = rand() % 65535 - 32767;
+                xQ[i] = rand() % 65535 - 32767;
+            } while (hypot(xI[i], xQ[i]) > 32767);
+            x[i] = PACK16((int32_t) xI[i], (int32_t) xQ[i]);
+            mR[i] = xI[i];
+            mI[i] = xQ[i];
+        }
+        ifftQ15(x, n);
+        modelIfft(mR, mI, n);
+        idft(xI, xQ, n);
+        for (i = 0; i < n; i++)
+        {
+            mismatches += x[i] != PACK16(mR[i], mI[i]);
+            e = hypot((int16_t) x[i] - refI[order[i]], (int16_t) (x[i] >> 16) - refQ[order[i]]);
+            err += e * e;
+            sig += refI[order[i]] * refI[order[i]] + refQ[order[i]] * refQ[order[i]];
+            if (e > worst)
+                worst = e;
+        }
+    }
+    fail = mismatches || 10 * log10(sig / err) < IFFT_SNR_MIN || worst > IFFT_ERR_MAX;
+    printf("ifft %3u:         %u model mismatches, rms %.2f max %.2f LSb, SNR %.1f dB  %s\n",
+           n, mismatches, sqrt(err / (IFFT_ROUNDS * n)), worst, 10 * log10(sig / err),
+           fail ? "FAIL" : "ok");
+    return fail;
+}
+
+// Carrier k (-n/2..n/2-1) as ofdm.c: 0 null, 1 data, 2 pilot
+static uint8_t carrierType(int16_t k, uint16_t used)
+{
+    int16_t m = (k < 0) ? -k : k;
+    if (m == 0 || m > used)
+        return 0;
+    return ((m + OFDM_PILOT_STEP / 2) % OFDM_PILOT_STEP == 0) ? 2 : 1;
+}
+
+// Two symbols as streamed, against the IDFT of a second pass of the mapper
+static int checkSymbols(SCHEME scheme, const char* name, uint16_t n, uint16_t cp)
+{
+    int32_t sI[2][OFDM_MAX + OFDM_CP_MAX], sQ[2][OFDM_MAX + OFDM_CP_MAX];
+    double xI[OFDM_MAX], xQ[OFDM_MAX], mult, e, err = 0, sig = 0, worst = 0, snr;
+    uint16_t used = n * 26 / 64, pilots = (used + OFDM_PILOT_STEP / 2) / OFDM_PILOT_STEP;
+    uint16_t i, s, bin, prefixErrors = 0;
+    uint32_t iq;
+    int16_t k;
+    int fail;
+
+    setScheme(scheme, I_GAIN, Q_GAIN);
+    setPayload("ofdm reference", 14);
+    setOfdm(n, cp, I_GAIN);
+    for (s = 0; s < 2; s++)
+        for (i = 0; i < n + cp; i++)
+            ofdmSample(&sI[s][i], &sQ[s][i]);
+
+    // Output scale of setOfdm, rounded to Q12 as there
+    mult = lround(I_GAIN / 4.0 / (sqrt((used - pilots) * (double) getSymbolPower()
+        + pilots * (double) I_GAIN * I_GAIN) / n) * 4096) / 4096.0;
+
+    resetModulator();
+    for (s = 0; s < 2; s++)
+    {
+        for (k = -(int16_t) (n / 2); k < (int16_t) (n / 2); k++)
+        {
+            bin = k & (n - 1);
+            xI[bin] = xQ[bin] = 0;
+            if (carrierType(k, used) == 1)
+            {
+                iq = mapNextSymbol();
+                xI[bin] = (int16_t) iq;
+                xQ[bin] = (int16_t) (iq >> 16);
+            }
+            else if (carrierType(k, used) == 2)
+                xI[bin] = I_GAIN;
+        }
+        idft(xI, xQ, n);
+        for (i = 0; i < n; i++)
+        {
+            e = hypot(sI[s][cp + i] - refI[i] * mult, sQ[s][cp + i] - refQ[i] * mult);
+            err += e * e;
+            sig += (refI[i] * refI[i] + refQ[i] * refQ[i]) * mult * mult;
+            if (e > worst)
+                worst = e;
+        }
+        for (i = 0; i < cp; i++)
+            prefixErrors += sI[s][i] != sI[s][n + i] || sQ[s][i] != sQ[s][n + i];
+    }
+    snr = 10 * log10(sig / err);
+    fail = snr < SYMBOL_SNR_MIN || prefixErrors;
+    printf("symbol %-6s %3u: max %.2f DAC LSb, SNR %.1f dB, prefix %s  %s\n",
+           name, n, worst, snr, prefixErrors ? "differs" : "equal", fail ? "FAIL" : "ok");
+    return fail;
+}
+
+static double seconds(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static void bench(uint16_t n)
+{
+    uint32_t x[OFDM_MAX], checksum = 0;
+    double xI[OFDM_MAX], xQ[OFDM_MAX], start, fixed, direct;
+    uint16_t i, r;
+    for (i = 0; i < n; i++)
+    {
+        xI[i] = rand() % 65535 - 32767;
+        xQ[i] = rand() % 65535 - 32767;
+    }
+    start = seconds();
+    for (r = 0; r < BENCH_ROUNDS; r++)
+    {
+        for (i = 0; i < n; i++)
+            x[i] = PACK16((int32_t) xI[i] + r, (int32_t) xQ[i]);
+        ifftQ15(x, n);
+        checksum += x[r % n];
+    }
+    fixed = (seconds() - start) / BENCH_ROUNDS;
+    start = seconds();
+    for (r = 0; r < BENCH_ROUNDS / 20; r++)
+        idft(xI, xQ, n);
+    direct = (seconds() - start) / (BENCH_ROUNDS / 20);
+    printf("bench %3u:        ifftQ15 %.2f us, direct IDFT %.1f us, x%.0f  (%08X)\n",
+           n, fixed * 1e6, direct * 1e6, direct / fixed, checksum);
+}
+
+int main(void)
+{
+    static const uint16_t sizes[] = {64, 128, 256};
+    int fail = 0;
+    uint8_t i;
+    srand(1);
+    for (i = 0; i < 3; i++)
+        fail |= checkIfft(sizes[i]);
+    for (i = 0; i < 3; i++)
+    {
+        fail |= checkSymbols(QPSK, "qpsk", sizes[i], sizes[i] / 4);
+        fail |= checkSymbols(QAM16, "16qam", sizes[i], sizes[i] / 8);
+    }
+    for (i = 0; i < 3; i++)
+        bench(sizes[i]);
+    return fail;
+}
@@ -0,0 +1,98 @@
+// PRBS Reference Checker (host)
+//
+// Confirms the word parallel generator of source/prbs.c against a plain
+// bit serial LFSR for every ITU-T O.150 polynomial: same bit stream over
+// several periods, period 2^m - 1, and the injected error rate.
+//
+// Build and run from the repository root:
+//   gcc -O2 -I source -o prbscheck tools/prbscheck.c source/prbs.c
+//   ./prbscheck [ORDER]
+// Exit status is non-zero on any mismatch.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "inc/prbs.h"
+
+// Bit serial reference: s[n] = s[n - k] ^ s[n - m]
+static uint32_t refState;
+
+static uint32_t refBit(const PRBS_POLY* p)
+{
+    uint32_t b = ((refState >> (p->tap - 1)) ^ (refState >> (p->order - 1))) & 1;
+    refState = ((refState << 1) | b) & ((1u << p->order) - 1);
+    return p->invert ? b ^ 1 : b;
+}
+
+static int popcount(uint32_t x)
+{
+    int n = 0;
+    for (; x; x &= x - 1)
+        n++;
+    return n;
+}
+
+// Compare words over the checked span and measure the period
+static int checkPoly(const PRBS_POLY* p)
+{
+    uint32_t period = (1u << p->order) - 1;
+    uint64_t bits = (p->order <= 23) ? 3ull * period + 5 : (1ull << 26);
+    uint64_t n, errors = 0, flips = 0;
+    uint32_t word, ref, first = 0, start;
+    int b;
+
+    setPrbs(p, 0);
+    setPrbsErrors(0);
+    refState = (1u << p->order) - 1;
+    for (n = 0; n < bits; n += 32)
+    {
+        word = nextPrbsWord();
+        ref = 0;
+        for (b = 0; b < 32; b++)
+            ref = (ref << 1) | refBit(p);
+        errors += popcount(word ^ ref);
+        if (n == 0)
+            first = word;
+    }
+
+    // Period: the register returns to the seed after exactly 2^m - 1 steps
+    if (p->order <= 23)
+    {
+        refState = start = (1u << p->order) - 1;
+        for (n = 1;; n++)
+        {
+            refBit(p);
+            if (refState == start)
+                break;
+        }
+        if (n != period)
+            errors++;
+    }
+
+    // Injected errors: one every 1000 bits
+    setPrbs(p, 0);
+    setPrbsErrors(1000);
+    refState = (1u << p->order) - 1;
+    for (n = 0; n < 32000; n += 32)
+    {
+        ref = 0;
+        for (b = 0; b < 32; b++)
+            ref = (ref << 1) | refBit(p);
+        flips += popcount(nextPrbsWord() ^ ref);
+    }
+    if (flips != 32)
+        errors++;
+
+    printf("PRBS%-2u x^%u + x^%u + 1%s: first word %08X, %s\n", p->order, p->order, p->tap,
+           p->invert ? " (inverted)" : "", first, errors ? "FAIL" : "ok");
+    return errors != 0;
+}
+
+int main(int argc, char** argv)
+{
+    int fail = 0, i;
+    for (i = 0; i < prbsPolyCount; i++)
+        if (argc < 2 || atoi(argv[1]) == prbsPolys[i].order)
+            fail |= checkPoly(&prbsPolys[i]);
+    return fail;
+}
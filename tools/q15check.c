@@ -0,0 +1,116 @@
+// Q15 Signal Path Checker (host)
+//
+// Runs the firmware symbol path (source/modulator.c with the RRC shaper)
+// for every scheme and compares it against a double precision model of
+// the same shaper fed with the same symbols. Reports the fixed point loss
+// as the SNR of the Q15 output against the model, how many DAC codes
+// differ after the output stage and by how much, and the rounding bound
+// of the constellation points (0.5 LSb per axis). The host build of the
+// firmware sources is itself the bit-exact reference of the target.
+//
+// Build and run from the repository root:
+//   gcc -O2 -I source -o q15check tools/q15check.c source/modulator.c
+//       source/constellation.c source/rrc.c source/prbs.c source/fec.c
+//       source/packet.c source/output.c source/nco.c source/fir.c source/tables.c
+//       -lm   (one line)
+//   ./q15check [SAMPLES]
+// Exit status is non-zero if any scheme falls below SNR_MIN.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include "inc/modulator.h"
+#include "inc/output.h"
+#include "inc/prbs.h"
+
+// Gains as in main.c
+#define I_GAIN ((4095 - 190) / 2)
+#define Q_GAIN ((4095 - 175) / 2)
+
+#define SNR_MIN 60.0                    // dB
+
+// Float taps normalized like the shaper: worst phase sum of |taps| is one
+static double taps[RRC_TAPS];
+
+static void initTaps(void)
+{
+    double worst = 0, sum;
+    uint8_t p, k;
+    for (p = 0; p < RRC_SPS; p++)
+    {
+        sum = 0;
+        for (k = p; k < RRC_TAPS; k += RRC_SPS)
+            sum += fabs(rrcTaps[k] / 32768.0);
+        if (sum > worst)
+            worst = sum;
+    }
+    for (k = 0; k < RRC_TAPS; k++)
+        taps[k] = rrcTaps[k] / 32768.0 / worst;
+}
+
+// Zero stuffed symbols of one rail through the float RRC
+static double shapeRef(const int32_t* held, long n, uint8_t lag)
+{
+    double acc = 0;
+    uint8_t k;
+    for (k = 0; k < RRC_TAPS && k <= n; k++)
+        if ((n - k) % RRC_SPS == lag)
+            acc += taps[k] * held[n - k];
+    return acc;
+}
+
+int main(int argc, char** argv)
+{
+    long n = (argc > 1) ? atol(argv[1]) : 200000, i;
+    int32_t *heldI = malloc(n * sizeof(int32_t)), *heldQ = malloc(n * sizeof(int32_t));
+    int32_t sI, sQ;
+    double refI, refQ, signal, noise, snr, bound;
+    long differ, worst;
+    int32_t d;
+    uint8_t s, lag;
+    const OUTPUT_STAGE* stage;
+    bool fail = false;
+
+    initOutputStage();
+    stage = getOutputStage();
+    initTaps();
+    setPrbs(&prbsPolys[findPrbs(15)], 0);
+    printf("scheme     shaper snr   dac codes differing   max diff   point rounding\n");
+    for (s = 0; s < SCHEME_COUNT; s++)
+    {
+        // Symbols held on each rail, then the same symbols shaped
+        setScheme((SCHEME) s, I_GAIN, Q_GAIN);
+        setShaping(false);
+        setSamplesPerSymbol(RRC_SPS);
+        setPrbsSource(true);
+        for (i = 0; i < n; i++)
+            modulatorSample(&heldI[i], &heldQ[i]);
+        setShaping(true);
+        lag = (s == OQPSK) ? RRC_SPS / 2 : 0;
+
+        signal = noise = 0;
+        differ = worst = 0;
+        for (i = 0; i < n; i++)
+        {
+            modulatorSample(&sI, &sQ);
+            refI = shapeRef(heldI, i, 0);
+            refQ = shapeRef(heldQ, i, lag);
+            signal += refI * refI + refQ * refQ;
+            noise += (sI - refI) * (sI - refI) + (sQ - refQ) * (sQ - refQ);
+
+            d = outputSample(&stage->ch[OUT_I], sI) - outputSample(&stage->ch[OUT_I], lround(refI));
+            differ += d != 0;
+            worst = labs(d) > worst ? labs(d) : worst;
+            d = outputSample(&stage->ch[OUT_Q], sQ) - outputSample(&stage->ch[OUT_Q], lround(refQ));
+            differ += d != 0;
+            worst = labs(d) > worst ? labs(d) : worst;
+        }
+        snr = 10 * log10(signal / noise);
+        bound = 10 * log10(2 / 12.0 / getSymbolPower());
+        printf("%-10s %7.1f dB   %17.2f %%   %8ld   %7.1f dB\n", schemeNames[s], snr, 50.0 * differ / n, worst, bound);
+        if (snr < SNR_MIN)
+            fail = true;
+    }
+    return fail;
+}
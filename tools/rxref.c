@@ -0,0 +1,351 @@
+// Reference Receiver (host)
+//
+// Demodulates a DAC trace of the digital modes and reports EVM, BER and
+// constellation statistics. The trace is the 16-bit word stream written
+// to the MCP4822 (uint16 little endian, e.g. decoded from a logic analyzer
+// capture of SSI0 or written by tools/txsim.c): words carrying the DAC
+// command bits are sorted into I (0x3xxx) and Q (0xBxxx), plain 12-bit
+// codes are taken as I, Q pairs. The receiver undoes the DAC_MID offset,
+// applies the matched filter (the firmware's RRC taps, or a boxcar of one
+// symbol for unshaped symbols), picks the symbol phase of maximum energy
+// per block of symbols, normalizes the gain by least squares against the
+// decisions and maps the decided points back to bits.
+//
+// The stream is sample synchronous to the DAC, so the symbol phase is a
+// whole sample; blocks whose phase moves point to dropped or doubled
+// words in the capture. BER is counted on the transmitted (coded) bits,
+// against a looped payload (-p) or a self-synchronized PRBS (-P).
+//
+// Build and run from the repository root:
+//   gcc -O2 -I source -o rxref tools/rxref.c tools/trace.c
+//       source/constellation.c source/rrc.c source/prbs.c -lm   (one line)
+//   ./rxref [-m SCHEME] [-s SPS] [-r] [-p TEXT | -P ORDER] [TRACE]
+// TRACE defaults to stdin.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include <math.h>
+#include <time.h>
+#include "inc/constellation.h"
+#include "inc/rrc.h"
+#include "inc/prbs.h"
+#include "trace.h"
+
+// Channel gains as in main.c
+#define I_GAIN ((4095 - 190) / 2)
+#define Q_GAIN ((4095 - 175) / 2)
+
+#define TIMING_BLOCK 1024               // symbols per timing decision
+#define SETTLE_SYMBOLS 16               // skipped at the start (filter fill)
+#define ALIGN_BITS 2048                 // bits used to find the reference alignment
+
+static CONSTELLATION cons;
+static int16_t inverse[CONSTELLATION_MAX];  // point index (or step) -> symbol, -1 = none
+
+// y = x * h, output aligned to the last input sample used
+static void filter(const float* x, float* y, size_t n, const float* h, uint8_t taps)
+{
+    size_t i;
+    uint8_t k;
+    float acc;
+    for (i = 0; i < n; i++)
+    {
+        acc = 0;
+        for (k = 0; k < taps && k <= i; k++)
+            acc += h[k] * x[i - k];
+        y[i] = acc;
+    }
+}
+
+// Nearest constellation point to (zI, zQ)
+static uint16_t decide(float zI, float zQ, float* dI, float* dQ)
+{
+    uint16_t k, best = 0;
+    float pI, pQ, d, bestD = INFINITY;
+    for (k = 0; k <= cons.pointMask; k++)
+    {
+        pI = (int16_t) cons.point[k];
+        pQ = (int16_t) (cons.point[k] >> 16);
+        d = (zI - pI) * (zI - pI) + (zQ - pQ) * (zQ - pQ);
+        if (d < bestD)
+        {
+            bestD = d;
+            best = k;
+            *dI = pI;
+            *dQ = pQ;
+        }
+    }
+    return best;
+}
+
+// Errors between bits[from..from+n) and a periodic reference of period bits
+static size_t countErrors(const uint8_t* bits, size_t from, size_t n, const uint8_t* ref, size_t period, size_t shift)
+{
+    size_t i, errors = 0;
+    for (i = 0; i < n; i++)
+        errors += bits[from + i] != ref[(shift + i) % period];
+    return errors;
+}
+
+// Payload BER: the payload loops, so find its bit alignment first
+static void payloadBer(const uint8_t* bits, size_t n, const char* text)
+{
+    size_t period = 8 * strlen(text), i, shift, best = 0, errors, bestErrors = SIZE_MAX;
+    size_t probe = n < ALIGN_BITS ? n : ALIGN_BITS;
+    uint8_t* ref = malloc(period);
+
+    for (i = 0; i < period; i++)
+        ref[i] = (text[i / 8] >> (7 - i % 8)) & 1;
+    for (shift = 0; shift < period; shift++)
+    {
+        errors = countErrors(bits, 0, probe, ref, period, shift);
+        if (errors < bestErrors)
+        {
+            bestErrors = errors;
+            best = shift;
+        }
+    }
+    errors = countErrors(bits, 0, n, ref, period, best);
+    printf("ber          %.3e (%zu / %zu bits, payload at bit %zu)\n", (double) errors / n, errors, n, best);
+    free(ref);
+}
+
+// PRBS BER: seed the generator from m received bits, retry further on if
+// the seed was hit by an error
+static void prbsBer(const uint8_t* bits, size_t n, uint8_t order)
+{
+    const PRBS_POLY* p = &prbsPolys[findPrbs(order)];
+    size_t start, i, errors = 0, checked;
+    uint32_t seed, word = 0;
+    uint8_t have;
+
+    for (start = 0; start + p->order + ALIGN_BITS <= n; start += ALIGN_BITS)
+    {
+        seed = 0;
+        for (i = 0; i < p->order; i++)
+            seed = (seed << 1) | (bits[start + i] ^ p->invert);
+        if (seed == 0 || !setPrbs(p, seed))
+            continue;
+        errors = 0;
+        have = 0;
+        for (i = start + p->order; i < n; i++)
+        {
+            if (have == 0)
+            {
+                word = nextPrbsWord();
+                have = 32;
+            }
+            errors += bits[i] != ((word >> --have) & 1);
+            if (i == start + p->order + ALIGN_BITS && errors > ALIGN_BITS / 8)
+                break;
+        }
+        if (i == n)
+        {
+            checked = n - start - p->order;
+            printf("ber          %.3e (%zu / %zu bits, PRBS%u locked at bit %zu)\n",
+                   (double) errors / checked, errors, checked, order, start);
+            return;
+        }
+    }
+    printf("ber          no PRBS%u lock\n", order);
+}
+
+int main(int argc, char** argv)
+{
+    const char* schemeName = "qpsk";
+    const char* text = NULL;
+    int sps = 4, opt, s;
+    bool rrc = false, differential = false, spi;
+    uint8_t order = 0, qLag, phase, *bits;
+    FILE* f = stdin;
+    float *xI, *xQ, *yI, *yQ, *h, *zI, *zQ;
+    size_t n, symbols, k, b, block, moves = 0, nbits;
+    uint8_t taps, lastPhase = 0;
+    uint16_t idx, prev = 0, j;
+    float energy, bestEnergy, scale, power = 0, dI, dQ, eI, eQ;
+    double num, den, err, errPeak, sumI, sumQ, powI, powQ;
+    double pointErr[CONSTELLATION_MAX] = {0};
+    size_t pointCount[CONSTELLATION_MAX] = {0};
+    clock_t start = clock();
+
+    while ((opt = getopt(argc, argv, "m:s:rp:P:")) != -1)
+        switch (opt)
+        {
+        case 'm': schemeName = optarg; break;
+        case 's': sps = atoi(optarg); break;
+        case 'r': rrc = true; break;
+        case 'p': text = optarg; break;
+        case 'P': order = atoi(optarg); break;
+        default:
+            fprintf(stderr, "usage: rxref [-m SCHEME] [-s SPS] [-r] [-p TEXT | -P ORDER] [TRACE]\n");
+            return 1;
+        }
+    if (rrc)
+        sps = RRC_SPS;
+    if (sps < 1 || sps > 16 || (order && findPrbs(order) < 0) || (text && !*text))
+    {
+        fprintf(stderr, "rxref: invalid samples/symbol, PRBS order or payload\n");
+        return 1;
+    }
+    s = findScheme(schemeName);
+    if (s < 0 && schemeName[0] == 'd')
+    {
+        s = findScheme(schemeName + 1);
+        differential = true;
+    }
+    if (s < 0)
+    {
+        fprintf(stderr, "rxref: unknown scheme %s\n", schemeName);
+        return 1;
+    }
+    buildConstellation(&cons, (SCHEME) s, I_GAIN, Q_GAIN);
+    if (!makeDifferential(&cons, differential))
+    {
+        fprintf(stderr, "rxref: %s is not a PSK\n", schemeName + 1);
+        return 1;
+    }
+    for (j = 0; j < CONSTELLATION_MAX; j++)
+        inverse[j] = -1;
+    for (j = 0; j <= cons.mask; j++)
+        inverse[cons.map[j]] = j;
+    for (j = 0; j <= cons.pointMask; j++)
+    {
+        dI = (int16_t) cons.point[j];
+        dQ = (int16_t) (cons.point[j] >> 16);
+        power += dI * dI + dQ * dQ;
+    }
+    power /= cons.pointMask + 1;
+
+    if (optind < argc && (f = fopen(argv[optind], "rb")) == NULL)
+    {
+        perror(argv[optind]);
+        return 1;
+    }
+    n = readTrace(f, &xI, &xQ, &spi);
+    symbols = n / sps;
+    if (symbols <= 2 * SETTLE_SYMBOLS)
+    {
+        fprintf(stderr, "rxref: trace too short\n");
+        return 1;
+    }
+
+    // Matched filter
+    taps = rrc ? RRC_TAPS : sps;
+    h = malloc(taps * sizeof(float));
+    for (k = 0; k < taps; k++)
+        h[k] = rrc ? rrcTaps[k] / 32768.0f : 1;
+    yI = malloc(n * sizeof(float));
+    yQ = malloc(n * sizeof(float));
+    filter(xI, yI, n, h, taps);
+    filter(xQ, yQ, n, h, taps);
+
+    // Timing: phase of maximum symbol energy per block, Q half a symbol later
+    // for offset schemes
+    qLag = cons.offset ? sps / 2 : 0;
+    symbols -= SETTLE_SYMBOLS + 1;
+    zI = malloc(symbols * sizeof(float));
+    zQ = malloc(symbols * sizeof(float));
+    for (block = 0; block < symbols; block += TIMING_BLOCK)
+    {
+        bestEnergy = -1;
+        phase = 0;
+        for (j = 0; j < sps; j++)
+        {
+            energy = 0;
+            for (k = block; k < symbols && k < block + TIMING_BLOCK; k++)
+            {
+                b = (k + SETTLE_SYMBOLS) * sps + j;
+                energy += yI[b] * yI[b] + yQ[b + qLag] * yQ[b + qLag];
+            }
+            if (energy > bestEnergy)
+            {
+                bestEnergy = energy;
+                phase = j;
+            }
+        }
+        if (block && phase != lastPhase)
+            moves++;
+        lastPhase = phase;
+        for (k = block; k < symbols && k < block + TIMING_BLOCK; k++)
+        {
+            b = (k + SETTLE_SYMBOLS) * sps + phase;
+            zI[k] = yI[b];
+            zQ[k] = yQ[b + qLag];
+        }
+    }
+
+    // Gain: RMS to the constellation power, then real least squares against
+    // the decisions (the trace carries no carrier, so no phase to recover)
+    den = 0;
+    for (k = 0; k < symbols; k++)
+        den += zI[k] * zI[k] + zQ[k] * zQ[k];
+    scale = sqrt(power * symbols / den);
+    for (j = 0; j < 3; j++)
+    {
+        num = 0;
+        den = 0;
+        for (k = 0; k < symbols; k++)
+        {
+            decide(zI[k] * scale, zQ[k] * scale, &dI, &dQ);
+            num += dI * zI[k] + dQ * zQ[k];
+            den += zI[k] * zI[k] + zQ[k] * zQ[k];
+        }
+        scale = num / den;
+    }
+
+    // Decisions, statistics and bits
+    bits = malloc(symbols * cons.bits);
+    nbits = 0;
+    err = errPeak = sumI = sumQ = powI = powQ = 0;
+    for (k = 0; k < symbols; k++)
+    {
+        zI[k] *= scale;
+        zQ[k] *= scale;
+        idx = decide(zI[k], zQ[k], &dI, &dQ);
+        eI = zI[k] - dI;
+        eQ = zQ[k] - dQ;
+        err += eI * eI + eQ * eQ;
+        if (eI * eI + eQ * eQ > errPeak)
+            errPeak = eI * eI + eQ * eQ;
+        pointErr[idx] += eI * eI + eQ * eQ;
+        pointCount[idx]++;
+        sumI += zI[k];
+        sumQ += zQ[k];
+        powI += zI[k] * zI[k];
+        powQ += zQ[k] * zQ[k];
+
+        // Differential schemes decode from the second symbol on
+        s = inverse[(idx - (prev & cons.diffMask)) & cons.pointMask];
+        prev = idx;
+        if (k == 0 && cons.diffMask)
+            continue;
+        if (s < 0)
+            s = 0;
+        for (j = cons.bits; j > 0; j--)
+            bits[nbits++] = (s >> (j - 1)) & 1;
+    }
+
+    printf("trace        %zu samples (%s)\n", n, spi ? "spi words" : "dac codes");
+    printf("symbols      %zu, %s, %d samples/symbol, %s matched filter\n", symbols,
+           schemeName, sps, rrc ? "rrc" : "boxcar");
+    printf("timing       phase %u / %d, %zu moves in %zu blocks\n", lastPhase, sps, moves, (symbols + TIMING_BLOCK - 1) / TIMING_BLOCK);
+    printf("gain         %.4f filter out / DAC LSb\n", 1 / scale);
+    printf("dc offset    I %+.2f  Q %+.2f DAC LSb\n", sumI / symbols, sumQ / symbols);
+    printf("iq ratio     %+.3f dB\n", 10 * log10(powI / powQ));
+    printf("evm          %.3f %% rms (%.1f dB), peak %.3f %%\n", 100 * sqrt(err / symbols / power),
+           10 * log10(err / symbols / power), 100 * sqrt(errPeak / power));
+    if (cons.pointMask < 16)
+        for (j = 0; j <= cons.pointMask; j++)
+            printf("  point %2u   %+6d %+6d  %7zu hits, evm %.3f %%\n", j, (int16_t) cons.point[j], (int16_t) (cons.point[j] >> 16),
+                   pointCount[j], pointCount[j] ? 100 * sqrt(pointErr[j] / pointCount[j] / power) : 0);
+    if (text)
+        payloadBer(bits, nbits, text);
+    else if (order)
+        prbsBer(bits, nbits, order);
+    printf("time         %.2f s\n", (double) (clock() - start) / CLOCKS_PER_SEC);
+    return 0;
+}
@@ -0,0 +1,338 @@
+// Spectrum Analyzer (host)
+//
+// Welch PSD of DAC traces (see tools/trace.h) with a radix-2 complex FFT,
+// Hann window and 50 % overlap over I + jQ, then per trace: total power,
+// occupied bandwidth (99 %), ACLR of the two adjacent channels, noise
+// floor, the strongest spurs outside the occupied band and the SFDR
+// against the peak, which is the figure of merit for the tone modes.
+// Traces are spread over worker threads; results print in argument order.
+//
+// Build and run from the repository root:
+//   gcc -O2 -I source -o spectrum tools/spectrum.c tools/trace.c -lm -lpthread
+//   ./spectrum [-f FS] [-n NFFT] [-b BW] [-c CENTER] [-j THREADS] TRACE...
+// BW is the ACLR channel bandwidth (default: the occupied bandwidth),
+// CENTER its center frequency (default 0 Hz). To sweep modes:
+//   for m in bpsk qpsk 16qam 64qam; do ./txsim -m $m -r -P 9 > $m.bin; done
+//   ./spectrum -j 4 *.bin
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include <math.h>
+#include <pthread.h>
+#include "trace.h"
+
+#define NFFT_MAX         65536
+#define OBW_FRACTION     0.99
+#define SPUR_MAX         5
+#define SPUR_WIDTH       2              // bins each side summed into a peak (Hann main lobe)
+#define SKIRT_WIDTH      8              // bins each side beyond the lobe for the local skirt
+#define SPUR_FLOOR_RATIO 10.0           // 10 dB above the floor and the local skirt
+#define FULL_SCALE       (2048.0 * 2048.0)  // 0 dBFS: complex tone of 2048 LSb per rail
+
+typedef struct _RESULT
+{
+    const char* name;
+    size_t samples;
+    bool spi;
+    double power;                       // dBFS
+    double peakFreq, peak;              // Hz, dBc
+    double obwLow, obwHigh;             // Hz
+    double aclrLow, aclrHigh;           // dBc, NAN outside +-fs/2
+    double floor;                       // dBc/Hz, median bin
+    uint8_t spurs;
+    double spurFreq[SPUR_MAX], spur[SPUR_MAX];  // Hz, dBc
+    double sfdr;                        // dB below the peak, NAN without spurs
+} RESULT;
+
+static float fs = 20000, bandwidth = 0, center = 0;
+static uint32_t nfft = 4096;
+static float window[NFFT_MAX], cosTable[NFFT_MAX / 2], sinTable[NFFT_MAX / 2];
+static uint32_t reversed[NFFT_MAX];
+static RESULT* results;
+static char** names;
+static int count, next = 0;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void initFft(void)
+{
+    uint32_t i, bits = 0, r, j;
+    while ((1u << bits) < nfft)
+        bits++;
+    for (i = 0; i < nfft; i++)
+    {
+        window[i] = 0.5 - 0.5 * cos(2 * M_PI * i / nfft);
+        for (r = 0, j = 0; j < bits; j++)
+            r |= ((i >> j) & 1) << (bits - 1 - j);
+        reversed[i] = r;
+    }
+    for (i = 0; i < nfft / 2; i++)
+    {
+        cosTable[i] = cos(2 * M_PI * i / nfft);
+        sinTable[i] = -sin(2 * M_PI * i / nfft);
+    }
+}
+
+// In place forward FFT, input in bit reversed order
+static void fft(float* re, float* im)
+{
+    uint32_t span, half, step, g, j, t;
+    float wr, wi, xr, xi;
+    for (span = 2; span <= nfft; span <<= 1)
+    {
+        half = span >> 1;
+        step = nfft / span;
+        for (g = 0; g < nfft; g += span)
+            for (j = 0; j < half; j++)
+            {
+                t = g + j + half;
+                wr = cosTable[j * step];
+                wi = sinTable[j * step];
+                xr = re[t] * wr - im[t] * wi;
+                xi = re[t] * wi + im[t] * wr;
+                re[t] = re[g + j] - xr;
+                im[t] = im[g + j] - xi;
+                re[g + j] += xr;
+                im[g + j] += xi;
+            }
+    }
+}
+
+// Power of the bins whose center lies in [f0, f1), linear
+static double bandPower(const double* psd, double f0, double f1)
+{
+    double sum = 0, f;
+    uint32_t k;
+    for (k = 0; k < nfft; k++)
+    {
+        f = ((double) k - nfft / 2) * fs / nfft;
+        if (f >= f0 && f < f1)
+            sum += psd[k];
+    }
+    return sum;
+}
+
+static int compareDouble(const void* a, const void* b)
+{
+    double x = *(const double*) a, y = *(const double*) b;
+    return (x > y) - (x < y);
+}
+
+// Sum of the bins around k, clipped to the spectrum
+static double peakPower(const double* psd, uint32_t k)
+{
+    double sum = 0;
+    int32_t j;
+    for (j = (int32_t) k - SPUR_WIDTH; j <= (int32_t) k + SPUR_WIDTH; j++)
+        if (j >= 0 && j < (int32_t) nfft)
+            sum += psd[j];
+    return sum;
+}
+
+// Mean of the bins just outside the main lobe around k, so a spur has to
+// stand out of a modulation skirt and not only of the noise floor
+static double skirt(const double* psd, uint32_t k)
+{
+    double sum = 0;
+    uint8_t used = 0;
+    int32_t d, j;
+    for (d = SPUR_WIDTH + 1; d <= SPUR_WIDTH + SKIRT_WIDTH; d++)
+        for (j = (int32_t) k - d; j <= (int32_t) k + d; j += 2 * d)
+            if (j >= 0 && j < (int32_t) nfft)
+            {
+                sum += psd[j];
+                used++;
+            }
+    return sum / used;
+}
+
+static void analyze(RESULT* r, const char* name)
+{
+    FILE* f;
+    float *xI, *xQ, *re, *im;
+    double *psd, *sorted, total = 0, cum, bw, floorBin, p, best;
+    size_t n, start, segments = 0;
+    uint32_t k, peakBin = 0, lowBin = 0, highBin = nfft - 1, spurBin = 0, j;
+    uint8_t s;
+    bool taken;
+
+    memset(r, 0, sizeof(*r));
+    r->name = name;
+    if ((f = fopen(name, "rb")) == NULL)
+        return;
+    n = readTrace(f, &xI, &xQ, &r->spi);
+    fclose(f);
+    r->samples = n;
+    if (n < nfft)
+        return;
+
+    // Welch average, bins reordered to -fs/2..fs/2
+    re = malloc(nfft * sizeof(float));
+    im = malloc(nfft * sizeof(float));
+    psd = calloc(nfft, sizeof(double));
+    sorted = malloc(nfft * sizeof(double));
+    for (start = 0; start + nfft <= n; start += nfft / 2)
+    {
+        for (k = 0; k < nfft; k++)
+        {
+            re[reversed[k]] = xI[start + k] * window[k];
+            im[reversed[k]] = xQ[start + k] * window[k];
+        }
+        fft(re, im);
+        for (k = 0; k < nfft; k++)
+            psd[(k + nfft / 2) % nfft] += (double) re[k] * re[k] + (double) im[k] * im[k];
+        segments++;
+    }
+
+    // Scale so the bins sum to the mean power in LSb^2 (Hann: sum w^2 = 3N/8)
+    for (k = 0; k < nfft; k++)
+    {
+        psd[k] /= segments * (double) nfft * nfft * 3 / 8;
+        total += psd[k];
+        if (psd[k] > psd[peakBin])
+            peakBin = k;
+    }
+    r->power = 10 * log10(total / FULL_SCALE);
+    r->peakFreq = ((double) peakBin - nfft / 2) * fs / nfft;
+    r->peak = 10 * log10(peakPower(psd, peakBin) / total);
+
+    // Occupied bandwidth: (1 - OBW_FRACTION) / 2 of the power either side
+    for (cum = 0, k = 0; k < nfft; k++)
+    {
+        cum += psd[k];
+        if (cum < total * (1 - OBW_FRACTION) / 2)
+            lowBin = k + 1;
+        if (cum < total * (1 + OBW_FRACTION) / 2)
+            highBin = k + 1;
+    }
+    if (highBin >= nfft)
+        highBin = nfft - 1;
+    r->obwLow = ((double) lowBin - nfft / 2 - 0.5) * fs / nfft;
+    r->obwHigh = ((double) highBin - nfft / 2 + 0.5) * fs / nfft;
+
+    // ACLR of equal channels either side of the main channel
+    bw = bandwidth ? bandwidth : r->obwHigh - r->obwLow;
+    p = bandPower(psd, center - bw / 2, center + bw / 2);
+    r->aclrLow = (center - 1.5 * bw >= -fs / 2) ? 10 * log10(bandPower(psd, center - 1.5 * bw, center - bw / 2) / p) : NAN;
+    r->aclrHigh = (center + 1.5 * bw <= fs / 2) ? 10 * log10(bandPower(psd, center + bw / 2, center + 1.5 * bw) / p) : NAN;
+
+    // Noise floor as the median bin
+    memcpy(sorted, psd, nfft * sizeof(double));
+    qsort(sorted, nfft, sizeof(double), compareDouble);
+    floorBin = sorted[nfft / 2];
+    r->floor = 10 * log10(floorBin / total * nfft / fs);
+
+    // Spurs: strongest narrow local maxima outside the occupied band
+    // (widened by the window main lobe), at least a lobe apart
+    r->sfdr = NAN;
+    for (s = 0; s < SPUR_MAX; s++)
+    {
+        best = 0;
+        for (k = 1; k + 1 < nfft; k++)
+        {
+            if (k + SPUR_WIDTH >= lowBin && k <= highBin + SPUR_WIDTH)
+                continue;
+            if (psd[k] < psd[k - 1] || psd[k] < psd[k + 1] || psd[k] < SPUR_FLOOR_RATIO * floorBin
+                || psd[k] < SPUR_FLOOR_RATIO * skirt(psd, k))
+                continue;
+            for (taken = false, j = 0; j < s; j++)
+                if (fabs(r->spurFreq[j] - ((double) k - nfft / 2) * fs / nfft) <= 2 * SPUR_WIDTH * fs / nfft)
+                    taken = true;
+            if (!taken && psd[k] > best)
+            {
+                best = psd[k];
+                spurBin = k;
+            }
+        }
+        if (best == 0)
+            break;
+        r->spurFreq[s] = ((double) spurBin - nfft / 2) * fs / nfft;
+        r->spur[s] = 10 * log10(peakPower(psd, spurBin) / total);
+        r->spurs++;
+    }
+    if (r->spurs)
+        r->sfdr = r->peak - r->spur[0];
+
+    free(xI);
+    free(xQ);
+    free(re);
+    free(im);
+    free(psd);
+    free(sorted);
+}
+
+static void* worker(void* arg)
+{
+    int i;
+    (void) arg;
+    for (;;)
+    {
+        pthread_mutex_lock(&lock);
+        i = next++;
+        pthread_mutex_unlock(&lock);
+        if (i >= count)
+            return NULL;
+        analyze(&results[i], names[i]);
+    }
+}
+
+static void print(const RESULT* r)
+{
+    uint8_t s;
+    printf("%s\n", r->name);
+    if (r->samples < nfft)
+    {
+        printf("  unreadable or shorter than %u samples\n", nfft);
+        return;
+    }
+    printf("  samples    %zu (%s), rbw %.2f Hz\n", r->samples, r->spi ? "spi words" : "dac codes", fs / nfft);
+    printf("  power      %.2f dBFS, peak %.2f dBc at %+.1f Hz\n", r->power, r->peak, r->peakFreq);
+    printf("  obw 99%%    %.1f Hz (%+.1f .. %+.1f Hz)\n", r->obwHigh - r->obwLow, r->obwLow, r->obwHigh);
+    printf("  aclr       lower %.2f dBc, upper %.2f dBc\n", r->aclrLow, r->aclrHigh);
+    printf("  floor      %.1f dBc/Hz\n", r->floor);
+    if (r->spurs)
+        printf("  sfdr       %.2f dB\n", r->sfdr);
+    for (s = 0; s < r->spurs; s++)
+        printf("  spur       %+.1f Hz %.2f dBc\n", r->spurFreq[s], r->spur[s]);
+}
+
+int main(int argc, char** argv)
+{
+    int opt, threads = 1, i;
+    pthread_t* pool;
+
+    while ((opt = getopt(argc, argv, "f:n:b:c:j:")) != -1)
+        switch (opt)
+        {
+        case 'f': fs = atof(optarg); break;
+        case 'n': nfft = atoi(optarg); break;
+        case 'b': bandwidth = atof(optarg); break;
+        case 'c': center = atof(optarg); break;
+        case 'j': threads = atoi(optarg); break;
+        default:
+            optind = argc;
+        }
+    if (optind >= argc || nfft < 64 || nfft > NFFT_MAX || (nfft & (nfft - 1)) || fs <= 0 || threads < 1)
+    {
+        fprintf(stderr, "usage: spectrum [-f FS] [-n NFFT] [-b BW] [-c CENTER] [-j THREADS] TRACE...\n");
+        return 1;
+    }
+    initFft();
+
+    names = &argv[optind];
+    count = argc - optind;
+    results = calloc(count, sizeof(RESULT));
+    if (threads > count)
+        threads = count;
+    pool = malloc(threads * sizeof(pthread_t));
+    for (i = 0; i < threads; i++)
+        pthread_create(&pool[i], NULL, worker, NULL);
+    for (i = 0; i < threads; i++)
+        pthread_join(pool[i], NULL);
+    for (i = 0; i < count; i++)
+        print(&results[i]);
+    return 0;
+}
@@ -0,0 +1,104 @@
+// Lookup Table Generator (host)
+//
+// Builds source/tables.c, the read-only tables the firmware used to fill
+// in RAM at boot: the NCO Q15 sine table and the FEC byte coding and
+// puncturing tables. As const data they live in flash, cost no .bss and
+// no start-up time. tools/feccheck.c verifies the FEC tables against its
+// bit serial reference.
+//
+// Build and run from the repository root:
+//   gcc -O2 -I source -o tablegen tools/tablegen.c -lm
+//   ./tablegen > source/tables.c
+
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include "inc/nco.h"
+
+#define G1 0x4F                         // 171 octal, newest input bit in bit 0
+#define G2 0x6D                         // 133 octal
+
+static uint8_t parity(uint8_t x)
+{
+    x ^= x >> 4;
+    x ^= x >> 2;
+    x ^= x >> 1;
+    return x & 1;
+}
+
+// Bit serial K=7 encoder, 16 code bits of byte b from state
+static uint16_t encodeSerial(uint8_t state, uint8_t b)
+{
+    uint16_t out = 0;
+    uint8_t i, sr;
+    for (i = 0; i < 8; i++)
+    {
+        sr = ((state << 1) | ((b >> (7 - i)) & 1)) & 0x7F;
+        out = (out << 2) | (parity(sr & G1) << 1) | parity(sr & G2);
+        state = sr & 0x3F;
+    }
+    return out;
+}
+
+// Keep the code bits flagged in pattern (MSB first), packed to the top
+static uint8_t compact(uint8_t bits, uint8_t pattern, uint8_t width)
+{
+    uint8_t out = 0;
+    int8_t i;
+    for (i = width - 1; i >= 0; i--)
+        if ((pattern >> i) & 1)
+            out = (out << 1) | ((bits >> i) & 1);
+    return out;
+}
+
+// One table, perLine values of at most digits hex digits per line
+static void printTable(const char* decl, const char* comment, const uint32_t* v, int n, int digits, int perLine)
+{
+    int i;
+    printf("// %s\n%s =\n{", comment, decl);
+    for (i = 0; i < n; i++)
+        printf("%s%s0x%0*X", i ? "," : "", i % perLine ? " " : "\n    ", digits, v[i]);
+    printf("\n};\n\n");
+}
+
+int main(void)
+{
+    static int16_t sine[NCO_SIZE];
+    static uint32_t v[NCO_SIZE];
+    int i;
+    int16_t s;
+
+    // Quarter wave mirrored, so the table is exactly odd and half wave symmetric
+    for (i = 0; i <= NCO_SIZE / 4; i++)
+    {
+        s = (int16_t) lroundf(32767 * sinf(2 * (float) M_PI * i / NCO_SIZE));
+        sine[i] = s;
+        sine[NCO_SIZE / 2 - i] = s;
+        sine[(NCO_SIZE / 2 + i) % NCO_SIZE] = -s;
+        sine[(NCO_SIZE - i) % NCO_SIZE] = -s;
+    }
+
+    printf("// Lookup Tables\n\n");
+    printf("// Generated by tools/tablegen.c, do not edit\n\n\n");
+    printf("#include <stdint.h>\n#include \"inc/nco.h\"\n#include \"inc/fec.h\"\n\n");
+
+    printf("// Q15 sine, one period over NCO_SIZE entries\n");
+    printf("const int16_t sineTable[NCO_SIZE] =\n{");
+    for (i = 0; i < NCO_SIZE; i++)
+        printf("%s%s%6d", i ? "," : "", i % 12 ? " " : "\n    ", sine[i]);
+    printf("\n};\n\n");
+
+    for (i = 0; i < 64; i++)
+        v[i] = encodeSerial(i, 0);
+    printTable("const uint16_t fecStateTable[64]", "Code bits of a zero byte from each encoder state", v, 64, 4, 12);
+    for (i = 0; i < 256; i++)
+        v[i] = encodeSerial(0, i);
+    printTable("const uint16_t fecByteTable[256]", "Code bits of each byte from state 0", v, 256, 4, 12);
+    for (i = 0; i < 16; i++)
+        v[i] = compact(i, 0xE, 4);
+    printTable("const uint8_t fecKeep23[16]", "Rate 2/3 puncturing, 4 code bits -> 3", v, 16, 2, 16);
+    for (i = 0; i < 64; i++)
+        v[i] = compact(i, 0x39, 6);
+    printTable("const uint8_t fecKeep34[64]", "Rate 3/4 puncturing, 6 code bits -> 4", v, 64, 2, 16);
+    return 0;
+}
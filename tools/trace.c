@@ -0,0 +1,62 @@
+// DAC Trace Reader (host)
+
+#include <stdlib.h>
+#include <stdint.h>
+#include "inc/output.h"
+#include "trace.h"
+
+// Trace words to baseband pairs in DAC LSb, returns the number of samples
+size_t readTrace(FILE* f, float** pI, float** pQ, bool* spi)
+{
+    size_t n = 0, size = 1 << 20, count, i;
+    uint16_t words[4096];
+    float* bI = malloc(size * sizeof(float));
+    float* bQ = malloc(size * sizeof(float));
+    int32_t q = DAC_MID, first = -1;
+    bool haveQ = false;
+
+    *spi = false;
+    while ((count = fread(words, sizeof(uint16_t), 4096, f)) > 0)
+        for (i = 0; i < count; i++)
+        {
+            if (n == size)
+            {
+                size *= 2;
+                bI = realloc(bI, size * sizeof(float));
+                bQ = realloc(bQ, size * sizeof(float));
+            }
+            switch (words[i] >> 12)
+            {
+            case 0xB:
+                *spi = true;
+                q = words[i] & 0xFFF;
+                haveQ = true;
+                break;
+            case 0x3:
+                *spi = true;
+                if (haveQ)
+                {
+                    bI[n] = DAC_MID - (int32_t) (words[i] & 0xFFF);
+                    bQ[n++] = DAC_MID - q;
+                }
+                break;
+            case 0x0:
+                if (*spi)
+                    break;
+                if (first < 0)
+                    first = words[i];
+                else
+                {
+                    bI[n] = DAC_MID - first;
+                    bQ[n++] = DAC_MID - (int32_t) words[i];
+                    first = -1;
+                }
+                break;
+            default:
+                break;
+            }
+        }
+    *pI = bI;
+    *pQ = bQ;
+    return n;
+}
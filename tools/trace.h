@@ -0,0 +1,18 @@
+// DAC Trace Reader (host)
+//
+// Shared by the host analysis tools. A trace is the 16-bit word stream
+// written to the MCP4822, uint16 little endian: words carrying the DAC
+// command bits are sorted into I (0x3xxx) and Q (0xBxxx, sent first),
+// plain 12-bit codes are taken as I, Q pairs. Samples are returned as
+// baseband in DAC LSb, DAC_MID - code, so the analog inversion is undone.
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+size_t readTrace(FILE* f, float** pI, float** pQ, bool* spi);
+
+#endif
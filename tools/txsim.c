@@ -0,0 +1,114 @@
+// Modulator Trace Simulator (host)
+//
+// Runs the firmware symbol path (bit source, FEC, mapper, RRC shaper and
+// output stage) or the sine mode (-t) on the host and writes the SPI words the sample ISR would
+// send to the MCP4822: per sample Q (0xBxxx) then I (0x3xxx), uint16
+// little endian. The trace is the input of tools/rxref.c and
+// tools/spectrum.c.
+//
+// Build and run from the repository root:
+//   gcc -O2 -I source -o txsim tools/txsim.c source/modulator.c
+//       source/constellation.c source/rrc.c source/prbs.c source/fec.c
+//       source/packet.c source/output.c source/nco.c source/fir.c source/tables.c
+//       -lm   (one line)
+//   ./txsim [-m SCHEME] [-s SPS] [-r] [-p TEXT | -P ORDER] [-t FREQ [-f FS]]
+//       [-n SAMPLES] > trace.bin
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include "inc/modulator.h"
+#include "inc/output.h"
+#include "inc/prbs.h"
+#include "inc/nco.h"
+
+// Gains and DAC command bits as in main.c
+#define I_GAIN ((4095 - 190) / 2)
+#define Q_GAIN ((4095 - 175) / 2)
+#define CHAN_I_START 12288
+#define CHAN_Q_START 45056
+
+int main(int argc, char** argv)
+{
+    const char* scheme = "qpsk";
+    const char* text = NULL;
+    int sps = 4, rrc = 0, order = 0, opt, s;
+    long n = 1000000, i;
+    int32_t sI, sQ;
+    uint32_t phase = 0, phi = 0;
+    float fs = 20000, tone = 0;
+    uint16_t w[2];
+    bool differential = false;
+
+    while ((opt = getopt(argc, argv, "m:s:rp:P:t:f:n:")) != -1)
+        switch (opt)
+        {
+        case 'm': scheme = optarg; break;
+        case 's': sps = atoi(optarg); break;
+        case 'r': rrc = 1; break;
+        case 'p': text = optarg; break;
+        case 'P': order = atoi(optarg); break;
+        case 't': tone = atof(optarg); break;
+        case 'f': fs = atof(optarg); break;
+        case 'n': n = atol(optarg); break;
+        default:
+            fprintf(stderr, "usage: txsim [-m SCHEME] [-s SPS] [-r] [-p TEXT | -P ORDER] [-t FREQ [-f FS]] [-n SAMPLES]\n");
+            return 1;
+        }
+
+    s = findScheme(scheme);
+    if (s < 0 && scheme[0] == 'd')
+    {
+        s = findScheme(scheme + 1);
+        differential = true;
+    }
+    if (s < 0)
+    {
+        fprintf(stderr, "txsim: unknown scheme %s\n", scheme);
+        return 1;
+    }
+    initOutputStage();
+    setScheme((SCHEME) s, I_GAIN, Q_GAIN);
+    setDifferential(differential);
+    setShaping(rrc);
+    if (!setSamplesPerSymbol(sps))
+    {
+        fprintf(stderr, "txsim: invalid samples/symbol\n");
+        return 1;
+    }
+    if (text)
+        setPayload(text, strlen(text));
+    if (order)
+    {
+        if (findPrbs(order) < 0)
+        {
+            fprintf(stderr, "txsim: unknown PRBS%d\n", order);
+            return 1;
+        }
+        setPrbs(&prbsPolys[findPrbs(order)], 0);
+        setPrbsSource(true);
+    }
+
+    if (tone)
+        phi = ncoFrequencyWord(tone, fs);
+
+    for (i = 0; i < n; i++)
+    {
+        if (tone)
+        {
+            // As the sine mode of main.c
+            sI = (-ncoSin(phase) * I_GAIN) >> 15;
+            sQ = (-ncoCos(phase) * Q_GAIN) >> 15;
+            phase += phi;
+        }
+        else
+            modulatorSample(&sI, &sQ);
+        correctSample(&getOutputStage()->corr, &sI, &sQ);
+        w[0] = CHAN_Q_START + outputSample(&getOutputStage()->ch[OUT_Q], sQ);
+        w[1] = CHAN_I_START + outputSample(&getOutputStage()->ch[OUT_I], sI);
+        fwrite(w, sizeof(w), 1, stdout);
+    }
+    return 0;
+}
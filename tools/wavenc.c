@@ -0,0 +1,114 @@
+// Flash Waveform Encoder (host)
+//
+// Builds source/wavedata.c, the ADPCM waveform library streamed by
+// flashwave.c, from raw I/Q captures.
+//
+// Input files: int16 little endian I/Q pairs in DAC LSb around zero
+// (the same format as the awg load upload), within +-ADPCM_SAMPLE_MAX:
+// the codec works on samples x16 in int16, so a capture beyond that is
+// refused rather than wrapped.
+//
+// Build and run from the repository root:
+//   gcc -O2 -I source -o wavenc tools/wavenc.c source/adpcm.c -lm
+//   ./wavenc NAME FILE [NAME FILE ...] > source/wavedata.c
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include "inc/adpcm.h"
+#include "inc/dsp.h"
+
+// Read a capture into separate I and Q arrays, returns the pair count, -1
+// if unreadable or -2 - i if pair i is out of range
+static long readCapture(const char* path, int16_t** sI, int16_t** sQ)
+{
+    FILE* f = fopen(path, "rb");
+    long n, i;
+    uint8_t b[4];
+    if (!f)
+        return -1;
+    fseek(f, 0, SEEK_END);
+    n = ftell(f) / 4;
+    fseek(f, 0, SEEK_SET);
+    *sI = malloc(n * sizeof(int16_t));
+    *sQ = malloc(n * sizeof(int16_t));
+    for (i = 0; i < n && fread(b, 1, 4, f) == 4; i++)
+    {
+        (*sI)[i] = (int16_t) (b[0] | (b[1] << 8));
+        (*sQ)[i] = (int16_t) (b[2] | (b[3] << 8));
+        if (abs((*sI)[i]) > ADPCM_SAMPLE_MAX || abs((*sQ)[i]) > ADPCM_SAMPLE_MAX)
+        {
+            fclose(f);
+            return -2 - i;
+        }
+    }
+    fclose(f);
+    return i;
+}
+
+int main(int argc, char* argv[])
+{
+    static uint8_t block[ADPCM_BLOCK_BYTES(ADPCM_BLOCK)];
+    static uint32_t decoded[ADPCM_BLOCK];
+    int16_t *sI, *sQ;
+    long n[64], i, first, bytes;
+    uint16_t len, k;
+    int w, count = (argc - 1) / 2;
+    double err, sig;
+
+    if (argc < 3 || (argc - 1) % 2 || count > 64)
+    {
+        fprintf(stderr, "usage: %s NAME FILE [NAME FILE ...] > wavedata.c\n", argv[0]);
+        return 1;
+    }
+
+    printf("// Flash Waveform Library data\n\n");
+    printf("// Generated by tools/wavenc.c, do not edit\n\n\n");
+    printf("#include <stdint.h>\n#include \"inc/flashwave.h\"\n\n");
+
+    for (w = 0; w < count; w++)
+    {
+        n[w] = readCapture(argv[2 + 2 * w], &sI, &sQ);
+        if (n[w] < -1)
+        {
+            fprintf(stderr, "%s: %s pair %ld beyond +-%d\n", argv[0], argv[2 + 2 * w], -2 - n[w], ADPCM_SAMPLE_MAX);
+            return 1;
+        }
+        if (n[w] <= 0)
+        {
+            fprintf(stderr, "%s: cannot read %s\n", argv[0], argv[2 + 2 * w]);
+            return 1;
+        }
+        err = 0;
+        sig = 0;
+        bytes = 0;
+        printf("// %s: %ld I/Q pairs\n", argv[1 + 2 * w], n[w]);
+        printf("static const uint8_t wave%d[] =\n{", w);
+        for (first = 0; first < n[w]; first += ADPCM_BLOCK)
+        {
+            len = (n[w] - first < ADPCM_BLOCK) ? n[w] - first : ADPCM_BLOCK;
+            encodeAdpcmBlock(block, &sI[first], &sQ[first], len);
+            decodeAdpcmBlock(decoded, block, len);
+            for (k = 0; k < len; k++)
+            {
+                err += pow((int16_t) decoded[k] - sI[first + k], 2) + pow((int16_t) (decoded[k] >> 16) - sQ[first + k], 2);
+                sig += pow(sI[first + k], 2) + pow(sQ[first + k], 2);
+            }
+            // Every block is padded to the full size so blocks can be indexed
+            for (i = 0; i < ADPCM_BLOCK_BYTES(ADPCM_BLOCK); i++, bytes++)
+                printf("%s%s0x%02X", bytes ? "," : "", bytes % 16 ? " " : "\n    ", i < ADPCM_BLOCK_BYTES(len) ? block[i] : 0);
+        }
+        printf("\n};\n\n");
+        fprintf(stderr, "%s: %ld pairs, %ld bytes (%.2fx), SNR %.1f dB\n", argv[1 + 2 * w], n[w], bytes,
+                4.0 * n[w] / bytes, 10 * log10(sig / (err ? err : 1)));
+        free(sI);
+        free(sQ);
+    }
+
+    printf("const WAVEFORM waveLibrary[] =\n{\n");
+    for (w = 0; w < count; w++)
+        printf("    {\"%s\", %ld, wave%d},\n", argv[1 + 2 * w], n[w], w);
+    printf("};\n\nconst uint8_t waveCount = %d;\n", count);
+    return 0;
+}